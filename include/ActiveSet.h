@@ -0,0 +1,98 @@
+#ifndef ACTIVESET_H_INCLUDED
+#define ACTIVESET_H_INCLUDED
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief ActiveSet
+ *
+ * The neurons that have anything pending - queued signals or a refractory period still running -
+ * as a dense list of neuron ids.
+ *
+ * @details Oct 2026: In a sparse network most neurons have an empty queue and nextEvent INT32_MAX.
+ * The event wheel already keeps them out of the tick; the active set keeps them out of the
+ * housekeeping as well. The purge sweep walks the members instead of the whole pool, so an idle
+ * neuron costs nothing per tick, and the member count is the network's activity for free.
+ *
+ * Membership is kept serially, at the end of the tick: a neuron joins when a signal lowers its
+ * nextEvent (Connections::deliverSignal, or the tick's reschedule list) or when it is due, which
+ * covers the cascades, and leaves when the purge sweep finds its queue empty and its refractory
+ * period over. A member can therefore be idle for up to one sweep lap, never the other way round.
+ *
+ * Insert and erase are O(1): position[] holds each member's index in the list, -1 for none, and
+ * erase moves the last member into the hole. Iteration is a walk over a contiguous int32 array.
+ */
+
+namespace active
+{
+    struct ActivityStats {
+        std::int32_t members{0};      // active neurons at the end of the tick
+        std::int32_t joined{0};       // neurons that became active during the tick
+        std::int32_t left{0};         // neurons the purge sweep found idle and dropped
+        std::int32_t due{0};          // neurons the event wheel handed out
+        std::int32_t cascades{0};     // due neurons that cascaded
+    };
+
+    class ActiveSet
+    {
+        public:
+
+        void resize(std::int32_t neuronCount)
+        {
+            // every neuron starts idle
+            m_members.clear();
+            m_position.assign(static_cast<std::size_t>(neuronCount), -1);
+        }
+
+        void swap(ActiveSet& other)
+        {
+            m_members.swap(other.m_members);
+            m_position.swap(other.m_position);
+        }
+
+        bool contains(std::int32_t neuronId) const { return m_position[neuronId] >= 0; }
+
+        bool insert(std::int32_t neuronId)
+        {
+            // true if the neuron was not already a member
+            if (m_position[neuronId] >= 0)
+            {
+                return false;
+            }
+            m_position[neuronId] = static_cast<std::int32_t>(m_members.size());
+            m_members.push_back(neuronId);
+            return true;
+        }
+
+        void erase(std::int32_t neuronId)
+        {
+            // the last member takes the erased one's place
+            std::int32_t hole = m_position[neuronId];
+            if (hole < 0)
+            {
+                return;
+            }
+            std::int32_t moved = m_members.back();
+            m_members[hole] = moved;
+            m_position[moved] = hole;
+            m_members.pop_back();
+            m_position[neuronId] = -1;
+        }
+
+        std::int32_t size() const { return static_cast<std::int32_t>(m_members.size()); }
+        bool empty() const { return m_members.empty(); }
+        std::int32_t operator[](std::int32_t idx) const { return m_members[idx]; }
+        const std::int32_t* begin() const { return m_members.data(); }
+        const std::int32_t* end() const { return m_members.data() + m_members.size(); }
+        const std::vector<std::int32_t>& members() const { return m_members; }
+
+        private:
+
+        std::vector<std::int32_t> m_members;      // dense neuron ids, in the order they joined or were moved
+        std::vector<std::int32_t> m_position;     // per neuron: index in m_members, -1 if idle
+    };
+
+}   // end active namespace
+
+#endif // ACTIVESET_H_INCLUDED
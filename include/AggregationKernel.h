@@ -0,0 +1,108 @@
+#ifndef AGGREGATIONKERNEL_H_INCLUDED
+#define AGGREGATIONKERNEL_H_INCLUDED
+
+#include <cstdint>
+
+#include "TCNConstants.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+
+/**
+ * @brief AggregationKernel
+ *
+ * Sums the decayed amplitudes of the signals inside a neuron's aggregation window - the value
+ * compared with cascadeThreshold.
+ *
+ * @details Oct 2026: A signal that arrived d ticks before the masterClock counts for
+ *      amplitude / aggregation_decay_factor^d        0 <= d < aggregation_window_ticks
+ * so with the defaults 1, 1/2, 1/4, 1/8, 1/16 of its amplitude, and nothing once it is
+ * aggregation_window_ticks old (the 1/32 point).
+ *
+ * This replaces a switch on masterClock - actionTime whose case labels were -1 .. -5. That
+ * distance is never negative, so only signals due exactly at the masterClock ever counted.
+ *
+ * The decay factor must be a power of two, so the division is a shift by d * decayShift and the
+ * loop body has no branches: staleness, the window bounds and the shift are all lane arithmetic
+ * the compiler can vectorize (with AVX2 the srb loads become gathers). Divisions round toward
+ * zero, exactly as the old / 2 .. / 32 did for inhibitory (negative) amplitudes.
+ *
+ * Oct 2026: distances are taken on the signals' own epoch (Signal::epochTime), so the 8 byte
+ * signal is read as it is; a longPast signal is always outside the window.
+ */
+
+namespace aggregation
+{
+    constexpr std::int32_t log2Exact(std::int32_t value)
+    {
+        return (value <= 1) ? 0 : 1 + log2Exact(value / 2);
+    }
+
+    inline constexpr std::int32_t decayShift{log2Exact(tcnconstants::aggregation_decay_factor)};   // per tick of distance
+    inline constexpr std::int32_t windowTicks{tcnconstants::aggregation_window_ticks};
+
+    static_assert((1 << decayShift) == tcnconstants::aggregation_decay_factor,
+                  "aggregation_decay_factor must be a power of two");
+    static_assert((windowTicks - 1) * decayShift < 31,
+                  "the oldest signal in the window must be shifted less than an int32");
+
+    constexpr std::int32_t decayed(std::int32_t amplitude, std::int32_t distance)
+    {
+        // amplitude / factor^distance, rounded toward zero like integer division
+        std::int32_t shift = distance * decayShift;
+        std::int32_t bias = (amplitude >> 31) & ((1 << shift) - 1);
+        return (amplitude + bias) >> shift;
+    }
+
+    inline std::int32_t accumulate(const std::int32_t* first, const std::int32_t* last,
+                                   const signal::Signal* srb, std::int32_t clock)
+    /**
+     * @brief Decayed sum of the signals behind the handles in [first, last) at clock. Stale
+     * handles and signals outside [clock - windowTicks + 1, clock] add nothing.
+     */
+    {
+        std::int32_t accumulator{0};
+        const std::int32_t epochClock = clock - signalEpoch;     // clock on the signals' epoch
+        for (; first != last; ++first)
+        {
+            const signal::Signal& sRef = srb[srb::handleSlot(*first)];
+            // unsigned, so a future signal's negative distance fails the window test too
+            std::uint32_t distance = static_cast<std::uint32_t>(epochClock) - static_cast<std::uint32_t>(sRef.epochTime);
+            bool inWindow = distance < static_cast<std::uint32_t>(windowTicks);
+            std::int32_t counts = -static_cast<std::int32_t>(inWindow & srb::isCurrent(*first));   // all ones or zero
+            accumulator += decayed(sRef.amplitude, inWindow ? static_cast<std::int32_t>(distance) : 0) & counts;
+        }
+        return accumulator;
+    }
+
+    inline std::int32_t accumulate(const std::int32_t* first, const std::int32_t* last,
+                                   const signal::Signal* srb, std::int32_t clock,
+                                   std::int32_t* contributors, std::int32_t& contributorCount)
+    /**
+     * @brief accumulate() that also records the sourceConnId of every signal it counts, in queue
+     * order, at contributors - room for last - first ids. contributorCount is set to how many.
+     *
+     * @details Oct 2026: the cascade path used to walk the window a second time to find these.
+     * Every id is written and the count moves on only for a counted signal, so the loop stays
+     * branch free.
+     */
+    {
+        std::int32_t accumulator{0};
+        std::int32_t count{0};
+        const std::int32_t epochClock = clock - signalEpoch;
+        for (; first != last; ++first)
+        {
+            const signal::Signal& sRef = srb[srb::handleSlot(*first)];
+            std::uint32_t distance = static_cast<std::uint32_t>(epochClock) - static_cast<std::uint32_t>(sRef.epochTime);
+            bool inWindow = distance < static_cast<std::uint32_t>(windowTicks);
+            std::int32_t counts = -static_cast<std::int32_t>(inWindow & srb::isCurrent(*first));
+            accumulator += decayed(sRef.amplitude, inWindow ? static_cast<std::int32_t>(distance) : 0) & counts;
+            contributors[count] = sRef.sourceConnId;
+            count -= counts;
+        }
+        contributorCount = count;
+        return accumulator;
+    }
+
+}   // end aggregation namespace
+
+#endif // AGGREGATIONKERNEL_H_INCLUDED
@@ -1,6 +1,10 @@
 #ifndef CONNECTION_H_DEF
 #define CONNECTION_H_DEF
 #include <cstdint>
+#include <climits>
+#include <vector>
+#include <string>
+#include <stdexcept>
 
 namespace connection
 
@@ -13,5 +17,137 @@ namespace connection
       int16_t ltpWeight{};                    // current weight for ltp amplification
   };
 
+  /**
+   * Oct 2026: A signal is timed by a 16 bit offset from the srb's epoch, so no connection may be
+   * further from its target than srb::maxSignalDistance ticks - toEpochTime would clamp the signal
+   * to the wrong tick. Nor may it be 0 ticks: the signal would be due at the tick that raised it,
+   * which the event wheel has already handed out. The network builder and pack() refuse such
+   * connections, and the fan-out throws rather than emit one (Connections::epochTime).
+   */
+  inline constexpr int32_t minTemporalDistance{1};
+  inline constexpr int32_t maxTemporalDistance{(1 << 14) - 1};    // srb::maxSignalDistance
+
+  inline bool validDistance(int32_t distance)
+  {
+    return distance >= minTemporalDistance && distance <= maxTemporalDistance;
+  }
+
+  /**
+   * Oct 2026: Packed connection pool - a hot/cold split of Connection.
+   *
+   * Every cascade reads the target, the distance and the combined weight of each connection it
+   * fans out to, while lastSignalOriginTime and the stp/ltp split only matter to learning. The
+   * packed pool keeps them in two parallel arrays indexed by connection id:
+   *    HotConnection   6 bytes     bits 8-31 target neuron (24 bits), bits 0-7 temporal distance,
+   *                                then weight = stpWeight + ltpWeight
+   *    ColdConnection  6 bytes     lastSignalOriginTime and ltpWeight; stpWeight is weight - ltpWeight
+   * 12 bytes a connection instead of 16, and the fan-out streams 6 of them instead of 16.
+   *
+   * A connection without a target (targetNeuronSlot < 0, the blank pool entries) is stored with
+   * target noPackedTarget and comes back with a temporalDistanceToTarget of -1. Any other
+   * connection must fit: target <= maxPackedTarget, 1 <= distance <= maxPackedDistance and
+   * stpWeight + ltpWeight within an int16 - pack() checks every one.
+   */
+  #pragma pack(push, 2)
+  struct HotConnection {
+      uint32_t targetDistance{};    // target << packedDistanceBits | temporal distance
+      int16_t weight{};             // stpWeight + ltpWeight
+  };
+
+  struct ColdConnection {
+      int32_t lastSignalOriginTime{};
+      int16_t ltpWeight{};
+  };
+  #pragma pack(pop)
+
+  static_assert(sizeof(HotConnection) == 6 && sizeof(ColdConnection) == 6, "packed connection records are 6 bytes");
+
+  inline constexpr int32_t packedDistanceBits{8};
+  inline constexpr uint32_t packedDistanceMask{(1u << packedDistanceBits) - 1};
+  inline constexpr int32_t maxPackedDistance{static_cast<int32_t>(packedDistanceMask)};
+  inline constexpr uint32_t noPackedTarget{(1u << (32 - packedDistanceBits)) - 1};
+  inline constexpr int32_t maxPackedTarget{static_cast<int32_t>(noPackedTarget) - 1};
+
+  inline int32_t packedTarget(const HotConnection& hot)
+  {
+    // -1 for a connection without a target, as in Connection
+    uint32_t target = hot.targetDistance >> packedDistanceBits;
+    return (target == noPackedTarget) ? -1 : static_cast<int32_t>(target);
+  }
+
+  inline int32_t packedDistance(const HotConnection& hot)
+  {
+    return static_cast<int32_t>(hot.targetDistance & packedDistanceMask);
+  }
+
+  inline bool fitsPacked(const Connection& conn)
+  {
+    int32_t weight = conn.stpWeight + conn.ltpWeight;
+    return conn.targetNeuronSlot < 0 ||
+           (conn.targetNeuronSlot <= maxPackedTarget &&
+            validDistance(conn.temporalDistanceToTarget) && conn.temporalDistanceToTarget <= maxPackedDistance &&
+            weight >= INT16_MIN && weight <= INT16_MAX);
+  }
+
+  inline HotConnection packHot(const Connection& conn)
+  {
+    // caller has checked fitsPacked()
+    bool targeted = conn.targetNeuronSlot >= 0;
+    uint32_t target = targeted ? static_cast<uint32_t>(conn.targetNeuronSlot) : noPackedTarget;
+    uint32_t distance = targeted ? static_cast<uint32_t>(conn.temporalDistanceToTarget) : packedDistanceMask;
+    return HotConnection{(target << packedDistanceBits) | distance,
+                         static_cast<int16_t>(conn.stpWeight + conn.ltpWeight)};
+  }
+
+  inline ColdConnection packCold(const Connection& conn)
+  {
+    return ColdConnection{conn.lastSignalOriginTime, conn.ltpWeight};
+  }
+
+  inline Connection unpack(const HotConnection& hot, const ColdConnection& cold)
+  {
+    int32_t target = packedTarget(hot);
+    return Connection{target, cold.lastSignalOriginTime, (target < 0) ? -1 : packedDistance(hot),
+                      static_cast<int16_t>(hot.weight - cold.ltpWeight), cold.ltpWeight};
+  }
+
+  inline void pack(const std::vector<Connection>& pool, std::vector<HotConnection>& hot, std::vector<ColdConnection>& cold)
+  {
+    /**
+     * @brief Convert a pool to the packed layout, connection id for connection id.
+     *
+     * @throws  std::out_of_range naming the first connection that does not fit; hot and cold
+     *          are left untouched
+     */
+    for (std::size_t c = 0; c < pool.size(); ++c)
+    {
+      if (!fitsPacked(pool[c]))
+      {
+        const Connection& conn = pool[c];
+        throw std::out_of_range("connection " + std::to_string(c) + " does not fit the packed layout: target " +
+                                std::to_string(conn.targetNeuronSlot) + ", distance " +
+                                std::to_string(conn.temporalDistanceToTarget) + ", weight " +
+                                std::to_string(conn.stpWeight + conn.ltpWeight));
+      }
+    }
+    hot.resize(pool.size());
+    cold.resize(pool.size());
+    for (std::size_t c = 0; c < pool.size(); ++c)
+    {
+      hot[c] = packHot(pool[c]);
+      cold[c] = packCold(pool[c]);
+    }
+  }
+
+  inline void unpack(const std::vector<HotConnection>& hot, const std::vector<ColdConnection>& cold,
+                     std::vector<Connection>& pool)
+  {
+    pool.resize(hot.size());
+    for (std::size_t c = 0; c < hot.size(); ++c)
+    {
+      pool[c] = unpack(hot[c], cold[c]);
+    }
+  }
+
 }   // end of connection namespace
-#endif
\ No newline at end of file
+#endif
@@ -2,10 +2,17 @@
 #define CONNECTIONS_H_INCLUDED
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "TCNConstants.h"
 #include "Connection.h"
 #include "Neuron.h"
 #include "SignalRingBuffer.h"
+#include "EventWheel.h"
+#include "TickPartitions.h"
+#include "FanOutKernel.h"
+#include "Learning.h"
+#include "Trace.h"
+#include "PoolStorage.h"
 
 // make this extern global so all can access it.
 
@@ -13,11 +20,17 @@ std::vector<connection::Connection> m_connPool{};
 int32_t currentConnectionSlot{0};  // allocation always returns ++currentConnectionSlot - 0 is default proto
 int32_t connectionPoolCapacity{};   // filled in by constructor
 
+// Oct 2026: the packed pool - m_connPool split into hot and cold arrays by Connections::packPool().
+// While connPoolPacked is set these are the connections and m_connPool is empty.
+std::vector<connection::HotConnection> m_connHot{};
+std::vector<connection::ColdConnection> m_connCold{};
+bool connPoolPacked{false};
+
 // other globals used by connections
 
 extern int32_t globalNextEvent;       // Definef in Neurons.h/cpp
 
-extern std::vector<neuron::Neuron> m_neuronPool;
+extern neuron::NeuronPool m_neuronPool;
 extern int32_t currentNeuronSlot; // forces start @ 0
 extern int32_t neuronPoolCapacity;
 
@@ -94,6 +107,7 @@ namespace conns
         // static int     *last_signal_clock_origin;      //used to determine how much STP & LTP decay has occurred
         // static int      next_connection_slot;          // used to allocate connections slots during
         int32_t nextSignalSlot;             
+        std::vector<tick::Delivery> m_outbox;   // scratch for generateOutGoingSignals
         
         // during building for the network
         // The signal size will be modified by STP and LTP and any other memory and enhancement actions
@@ -102,22 +116,21 @@ namespace conns
         Connections(std::int32_t connectionPoolSize)
         {
             #ifdef TESTING_MODE
-            m_connPool.reserve(75);
-            #else
-            m_connPool.reserve(connectionPoolSize);
+            connectionPoolSize = 75;
             #endif
             
-            connectionPoolCapacity = m_connPool.capacity();
-            
             // now fill the vector with 'blank' connection entries
             // none of the values are valid
+            // Oct 2026: in one bulk fill rather than a push_back per connection - see PoolStorage.h
             
             connection::Connection blankConnection {
                 -1, -1, -1, -1, -1
             };
-            for (int i = 0; i < connectionPoolCapacity; ++i){
-                m_connPool.push_back(blankConnection);
-            }
+            pools::fill(m_connPool, static_cast<std::size_t>(connectionPoolSize), blankConnection);
+            connectionPoolCapacity = static_cast<int32_t>(m_connPool.size());
+            std::vector<connection::HotConnection>().swap(m_connHot);
+            std::vector<connection::ColdConnection>().swap(m_connCold);
+            connPoolPacked = false;
 
             // std::cout << "\nCreated " << std::to_string(connectionPoolCapacity) << " empty connections\n";
             
@@ -129,12 +142,60 @@ namespace conns
         
         void printConnectionFromIndex(int32_t cidx)
         {
+            connection::Connection conn = connectionAt(cidx);
             std::cout << "\nConnection Index:= " << std::to_string(cidx) << '\n';
-            std::cout << "Target Neuron:= " << std::to_string(m_connPool[cidx].targetNeuronSlot);
-            std::cout << "\nTemporalDistance:= "<< std::to_string(m_connPool[cidx].temporalDistanceToTarget);
-            std::cout << "\nLast Signal:= " << std::to_string(m_connPool[cidx].lastSignalOriginTime);
-            std::cout << "\nSTP Weight:= " << std::to_string(m_connPool[cidx].stpWeight);
-            std::cout << "\nLRP Weight:= " << std::to_string(m_connPool[cidx].ltpWeight) << '\n';
+            std::cout << "Target Neuron:= " << std::to_string(conn.targetNeuronSlot);
+            std::cout << "\nTemporalDistance:= "<< std::to_string(conn.temporalDistanceToTarget);
+            std::cout << "\nLast Signal:= " << std::to_string(conn.lastSignalOriginTime);
+            std::cout << "\nSTP Weight:= " << std::to_string(conn.stpWeight);
+            std::cout << "\nLRP Weight:= " << std::to_string(conn.ltpWeight) << '\n';
+        }
+
+        static connection::Connection connectionAt(int32_t cidx)
+        {
+            // a copy in the Connection layout, whichever pool is live
+            return connPoolPacked ? connection::unpack(m_connHot[cidx], m_connCold[cidx]) : m_connPool[cidx];
+        }
+
+        static int32_t signalOwner(const signal::Signal& signal)
+        {
+            // Oct 2026: the neuron a signal was sent to - its source connection's target; -1 for a
+            // signal that came from no connection (injected by hand, or a blank slot)
+            return (signal.sourceConnId > 0) ? connectionAt(signal.sourceConnId).targetNeuronSlot : -1;
+        }
+
+        void packPool()
+        {
+            /**
+            * @brief Switch to the packed pool: m_connPool is split into m_connHot and m_connCold and released.
+            * 
+            * @details Oct 2026: for a built network - the builders and the tests write m_connPool, so pack
+            * once the connections are laid down. Signals, learning and snapshots all work on the packed
+            * pool from then on, and unpackPool() goes back. The conversion is checked first, so a pool
+            * that does not fit is left as it is.
+            * 
+            * @throws  std::out_of_range naming the first connection that does not fit (see Connection.h)
+            */
+            if (connPoolPacked)
+            {
+                return;
+            }
+            connection::pack(m_connPool, m_connHot, m_connCold);
+            std::vector<connection::Connection>().swap(m_connPool);
+            connPoolPacked = true;
+        }
+
+        void unpackPool()
+        {
+            // back to m_connPool, connection ids unchanged
+            if (!connPoolPacked)
+            {
+                return;
+            }
+            connection::unpack(m_connHot, m_connCold, m_connPool);
+            std::vector<connection::HotConnection>().swap(m_connHot);
+            std::vector<connection::ColdConnection>().swap(m_connCold);
+            connPoolPacked = false;
         }
         // number of connections created
         // static int     get_target_neuron(int);          // return numer of target neuron
@@ -199,6 +260,9 @@ namespace conns
             * qualifying neurons that cascade. The magnitude of the cascade causing
             * event is of no concern to the signal generator.
             * 
+            * Oct 2026: the tick engine no longer calls this - it collects each cascade's signals into
+            * its partition outbox with collectOutgoingSignals and emits them at the tick barrier.
+            * This is the immediate version of the same three steps for single neuron callers.
             */
             // 
             // Loop through all of the connections for a neuron and generate and
@@ -206,61 +270,199 @@ namespace conns
             // There will be as many signals generate as there are valid connections
             // in the outgoingSignals queue.
 
-            std::cout << "\nGenerate signals called with neuronId:= " << std::to_string(neuronId);
+            TCN_TRACE(DEBUG, "\nGenerate signals called with neuronId:= " << std::to_string(neuronId));
+
+            m_outbox.clear();
+            int32_t earliest = collectOutgoingSignals(neuronId, m_outbox);
+
+            // Oct 2026: one srb reservation for the whole fan-out, as the tick engine does per partition.
+            // The Grow policy decides slot by slot, so it keeps the one at a time allocation.
+            int32_t count = static_cast<int32_t>(m_outbox.size());
+            if (srbWrapPolicy != srb::WrapPolicy::Grow && count <= signalBufferCapacity)
+            {
+                srb::SlotBlock slots = srbObj.reserveSlots(count);
+                for (const tick::Delivery& delivery : m_outbox)
+                {
+                    deliverSignal(delivery, emitSignal(delivery, slots));
+                    TCN_TRACE(DEBUG, "\nSignal generated to neuron:= " << std::to_string(delivery.target));
+                }
+                srbObj.commitSlots(slots.liveOverwrites);
+            }
+            else
+            {
+                for (const tick::Delivery& delivery : m_outbox)
+                {
+                    deliverSignal(delivery, emitSignal(delivery));
+                    TCN_TRACE(DEBUG, "\nSignal generated to neuron:= " << std::to_string(delivery.target));
+                }
+            }
+
+            // the whole fan-out moves the globalNextEvent once
+            globalNextEvent = (globalNextEvent < earliest) ? globalNextEvent : earliest;
+            return neuronId;
+        }
+
+        int32_t collectOutgoingSignals(int32_t neuronId, std::vector<tick::Delivery>& outbox)
+        {
+            /**
+            * @brief Append a Delivery to outbox for every valid connection of a cascading neuron.
+            * 
+            * @return  the earliest actionTime appended, INT32_MAX if there was none
+            * 
+            * @details Oct 2026: first of the three steps that used to be generateASignal. Only the
+            * cascading neuron's own connections are touched (lastSignalOriginTime), so partitions
+            * can collect in parallel. Nothing is allocated in the srb and nothing is enqueued yet.
+            * 
+            * Oct 2026: the fan-out goes through fanout::collect a batch of eight connections at a
+            * time (AVX2 when the build has it). Debug trace builds keep the connection by connection
+            * loop below so the trace output is unchanged; both give the same Deliveries.
+            */
+            if (connPoolPacked)
+            {
+                // the packed pool has no connection by connection debug trace
+                neuron::NeuronPool::OutgoingRange fanOut = m_neuronPool.outgoing(neuronId);
+                return fanout::collect(fanOut.begin(), fanOut.end(), m_connHot.data(), m_connCold.data(), masterClock, outbox);
+            }
+            if constexpr (!trace::enabled<DEBUG>)
+            {
+                neuron::NeuronPool::OutgoingRange fanOut = m_neuronPool.outgoing(neuronId);
+                return fanout::collect(fanOut.begin(), fanOut.end(), m_connPool.data(), masterClock, outbox);
+            }
 
-            for (int32_t connIdx : m_neuronPool[neuronId].outgoingSignals)
+            int32_t earliest{INT32_MAX};
+            for (int32_t connIdx : m_neuronPool.outgoing(neuronId))
             {
-                std::cout << "\noutgoing targetNeuronSlot:= " << std::to_string(m_connPool[connIdx].targetNeuronSlot);
+                TCN_TRACE(DEBUG, "\noutgoing targetNeuronSlot:= " << std::to_string(m_connPool[connIdx].targetNeuronSlot));
                 if (m_connPool[connIdx].targetNeuronSlot >= 0)      // not an empty proto connection
                 {
-                    std::cout << "\nTrue distance vs. refractoryEnd:= " << 
-                        std::to_string(m_connPool[connIdx].temporalDistanceToTarget + masterClock) << " vs. " <<
-                        std::to_string(m_neuronPool[neuronId].refractoryEnd);
+                    // Oct 2026: no refractory test - this neuron's refractoryEnd is behind the masterClock
+                    // as it cascades, and the target skips signals due in its own refractory period.
+                    outbox.push_back(prepareSignal(connIdx));
+                    earliest = (outbox.back().actionTime < earliest) ? outbox.back().actionTime : earliest;
+                }
+            }
+            return earliest;
+        }
+
+        tick::Delivery prepareSignal(int32_t connIdx)
+        {
+            /**
+            * @brief Work out the signal a connection sends now and stamp the connection's last signal time.
+            */
+            TCN_TRACE(DEBUG, "\nGenerate a signal for connection:= " << std::to_string(connIdx));
+            TCN_TRACE_DO(DEBUG, printConnectionFromIndex(connIdx));
+
+            if (connPoolPacked)
+            {
+                const connection::HotConnection& hot = m_connHot[connIdx];
+                std::int16_t amplitude = fanout::stamp(fanout::PackedPool{m_connHot.data(), m_connCold.data()},
+                                                       connIdx, masterClock);
+                return tick::Delivery{connIdx, connection::packedTarget(hot),
+                                      masterClock + connection::packedDistance(hot), amplitude};
+            }
 
-                    // now check if target is refractory - ergo accept no signal for refractory period
-                    // Have to add masterClock to get actual real clock time as connection temporalDistance is always relative
+            connection::Connection& conn = m_connPool[connIdx];
 
-                    if ( m_connPool[connIdx].temporalDistanceToTarget + masterClock >
-                        m_neuronPool[neuronId].refractoryEnd )      
-                        {
-                            // only generate a signal if connection real clock is beyond refractory end
-                            // otherwise no point in generating a signal.
-                            // These are future post-refractory signals have not yet arrived.
+            // Update the last signal time for this connection - used for stp/ltp aging.
+            // No comparison needed as any prior signals would have been older
+            // Oct 2026: the stp/ltp decay since the last signal is applied first (lazy decay)
+            int16_t amplitude = fanout::stamp(m_connPool.data(), connIdx, masterClock);
 
-                            signalEventTime = generateASignal(connIdx); // receive signal event time back
+            return tick::Delivery{
+                connIdx,
+                conn.targetNeuronSlot,                                      // target is the signal owner
+                masterClock + conn.temporalDistanceToTarget,                // relative distance
+                amplitude};                                                 // moderated amplitudes
+        }
 
-                            // Every time we push a signal to a neuron we have to check the target neuron nextEvent.
-                            // But this would become very, very expensive if there were lots of signals pushed to the same
-                            // neuron.
-                            // Not True! Each signal push just has to check itself against the nextEvent to
-                            // see if this is older and update neuron nextEvent and globalNextEvent accordingly.
-                            // These should be very cheap tests                            
+        static std::int16_t epochTime(const tick::Delivery& delivery)
+        {
+            // Oct 2026: toEpochTime clamps a signal beyond srb::maxSignalDistance to the wrong tick, and
+            // the wheel has already handed out the tick a 0 distance signal is due at - a connection
+            // built outside netbuild and pack() is refused here instead.
+            const std::int64_t distance = static_cast<std::int64_t>(delivery.actionTime) - masterClock;
+            if (distance < connection::minTemporalDistance || distance > srb::maxSignalDistance)
+            {
+                throw std::out_of_range("Connections: connection " + std::to_string(delivery.connId) + " emits a signal " +
+                                        std::to_string(distance) + " ticks ahead, outside 1 .. srb::maxSignalDistance");
+            }
+            return srb::toEpochTime(delivery.actionTime);
+        }
 
-                            m_neuronPool[neuronId].nextEvent = 
-                                    (signalEventTime >= m_neuronPool[neuronId].nextEvent) ?
-                                        m_neuronPool[neuronId].nextEvent : signalEventTime;
+        srb::SignalHandle emitSignal(const tick::Delivery& delivery)
+        {
+            /**
+            * @brief Allocate an srb slot for a prepared signal and fill it in.
+            * 
+            * @details Oct 2026: the srb cursor is shared by the whole TCN, so this is the one step of
+            * signal generation that always runs serially - at the tick barrier, in neuron order.
+            */
 
-                            // Save the next actionTime if it's smaller than the current globalNextEvent.
-                            // This should avoid bothering with the scanning the incoming signals queue of every neuron
-                            // to set their nextEvent and just run through any non-empty incoming signals queue.
+            // SRB is different as it can wrap  
+            // Oct 2026: allocate through the srb so wraps and live overwrites are counted and
+            // the wrap policy applies. It is inline in the header so the call costs nothing.
+            nextSignalSlot = srbObj.allocateSignalSlot();
 
+            // srb is a vector of signal::Signal structs 
+            // Use return of index to next srb slot - pseudo_allocation.
+            // Oct 2026: no owner field - the owner is the source connection's target (signalOwner)
+            m_srb[nextSignalSlot] = signal::Signal{
+                delivery.connId,                                // source is the generating connnection
+                epochTime(delivery),
+                delivery.amplitude};
 
-                            globalNextEvent = (signalEventTime >= globalNextEvent) ?
-                                                    globalNextEvent : signalEventTime;
+            TCN_TRACE(DEBUG, "\nCreated this signal:.... for nextSignalSlot:= " << std::to_string(nextSignalSlot));
+            TCN_TRACE_DO(DEBUG, srbObj.printSignalFromIndex(nextSignalSlot));
 
+            // the queue holds a generation tagged handle so a later reuse of the slot is detected.
+            return srb::makeHandle(nextSignalSlot);
+        }
 
-                            std::cout << "\nSignal generated to neuron:= " << std::to_string(neuronSignaled);
-                        }
-                    }
-                    
-                    // if (connectionIsNotFiller(ptr))
-                    // {
-                    //     generateASignal(ptr);
-                    // }
-                }
-                return neuronId;
+        srb::SignalHandle emitSignal(const tick::Delivery& delivery, srb::SlotBlock& slots)
+        {
+            /**
+            * @brief emitSignal into the next slot of a block reserved by SignalRingBuffer::reserveSlots.
+            * 
+            * @details Oct 2026: the block belongs to one partition, so partitions emit in parallel
+            * without touching the shared srb cursor.
+            */
+            int32_t slot = slots.take();
+            m_srb[slot] = signal::Signal{delivery.connId, epochTime(delivery), delivery.amplitude};
+
+            TCN_TRACE(DEBUG, "\nCreated this signal:.... for nextSignalSlot:= " << std::to_string(slot));
+            TCN_TRACE_DO(DEBUG, srbObj.printSignalFromIndex(slot));
+            return slots.handle(slot);
+        }
+
+        bool enqueueSignal(int32_t targetNeuron, srb::SignalHandle handle, int32_t actionTime)
+        {
+            /**
+            * @brief Put an emitted signal on its target's queue and lower the target nextEvent.
+            * 
+            * @return  true if the target nextEvent moved, so the event wheel has to be told.
+            * 
+            * @details Oct 2026: touches nothing but the target neuron, so partitions enqueue their own
+            * neurons in parallel. The caller owns the event wheel update.
+            */
+            TCN_TRACE(DEBUG, "\nAbout to push signal to targetNode: = " << std::to_string(targetNeuron));
+
+            // incomingSignals if a vector of indexes into the srb buffer
+            // Oct 2026: kept in actionTime order so the target's aggregation window is a slice. Handles
+            // that went stale in the queue are passed over, so the current ones stay in order.
+            m_neuronPool.incomingSignals[targetNeuron].insert_sorted(handle, srb::handleQueueKey);
+
+            // Now we have to update the neuron nextEvent to the absolute future time.
+            // Oct 2026: Only when the signal lowers the target nextEvent does the target need a new
+            // entry in the event wheel. Later signals are picked up when the target is processed
+            // and recomputes its nextEvent from its queue.
+            if (actionTime < m_neuronPool.nextEvent[targetNeuron])
+            {
+                m_neuronPool.nextEvent[targetNeuron] = actionTime;
+                return true;
             }
-            
+            return false;
+        }
+
           int32_t generateASignal(int32_t connIdx)
             {
                 /**
@@ -285,76 +487,41 @@ namespace conns
                 * 
                 * July 2025:    Add new sourceConnId to signal for group STP/LTP processing 
                 * 
+                * Oct 2026:     prepare, emit and deliver in one go - see prepareSignal, emitSignal and
+                *               enqueueSignal for the steps the tick engine runs separately.
+                * 
                 * @return event time of signal generated for nextEvent tracking
                 * 
                 */
+                tick::Delivery delivery = prepareSignal(connIdx);
+                deliverSignal(delivery, emitSignal(delivery));
 
-                std::cout << "\nGenerate a signal for connection:= " << std::to_string(connIdx);
-                printConnectionFromIndex(connIdx);
+                // And now check globalNextEvent
+                globalNextEvent = (globalNextEvent < delivery.actionTime) ? globalNextEvent : delivery.actionTime;
+                return delivery.actionTime;    // this is the time for this signal event
+            }
 
-                // SRB is different as it can wrap  
-                if (currentSignalSlot >= signalBufferCapacity) {
-                    currentSignalSlot = 0;
-                    nextSignalSlot = 0;
-                }
-                else { 
-                    nextSignalSlot = ++currentSignalSlot; 
+            void deliverSignal(const tick::Delivery& delivery, srb::SignalHandle handle)
+            {
+                // immediate enqueue: schedule the target straight away - the caller moves the globalNextEvent
+                targetNeuronId = delivery.target;
+                if (enqueueSignal(targetNeuronId, handle, delivery.actionTime))
+                {
+                    eventWheel.schedule(targetNeuronId, delivery.actionTime);
                 }
-                
-                // srb is a vector of signal::Signal structs 
-                // Use return of index to next srb slot - pseudo_allocation.
-                 
-                // fill in the signal values before enqueueing to the target
-                m_srb[nextSignalSlot].actionTime = masterClock + m_connPool[connIdx].temporalDistanceToTarget;   // relative distance
-                m_srb[nextSignalSlot].amplitude = m_connPool[connIdx].stpWeight + m_connPool[connIdx].ltpWeight;  // moderated amplitudes
-                m_srb[nextSignalSlot].owner = m_connPool[connIdx].targetNeuronSlot;     // target is the signal owner
-                m_srb[nextSignalSlot].sourceConnId = connIdx;   // source is the generating connnection
-
-                // Update the last signal time for this connection - used for stp/ltp aging.
-                // No comparison needed as any prior signals would have been older
-                m_connPool[connIdx].lastSignalOriginTime = masterClock;
-
-                std::cout << "\nCreated this signal:.... for nextSignalSlot:= " << std::to_string(nextSignalSlot);
-                srbObj.printSignalFromIndex(nextSignalSlot);
-
-                signal::Signal sigRef = m_srb[nextSignalSlot];  // this should point to the signal we are building
-                // srbObj.printSignalFromRef(signalRef);        // This should ref the same signal
-                
-                // targetNeuronId = ptr->targetNeuronSlot; // this is where to enqueue the signal
-                // m_neuronPool[targetNeuronId].incomingSignals.push_back(&signalRef);
-                // incomingSignals is a vector of pointers to Signal structs
-                
-                // m_neuronPool[ptr->targetNeuronSlot].incomingSignals.push_back(&signalRef);
-                // Just push the srb index into the target's incomingSignal queue.
-
-                std::cout << "\nAbout to push signal to targetNode: = " << std::to_string(m_connPool[connIdx].targetNeuronSlot);
-
-                // incomingSignals if a vector of indexes into the srb buffer
-                m_neuronPool[m_connPool[connIdx].targetNeuronSlot].incomingSignals.push_back(nextSignalSlot);
-
-                // Now we have to update the neuron nextEvent and the globalNextEvent to the absolute future time
-
-                m_neuronPool[m_connPool[connIdx].targetNeuronSlot].nextEvent =
-                    (m_neuronPool[m_connPool[connIdx].targetNeuronSlot].nextEvent <= sigRef.actionTime + masterClock) ?
-                       m_neuronPool[m_connPool[connIdx].targetNeuronSlot].nextEvent  :  // Leave it alone
-                         sigRef.actionTime + masterClock;                               // else update it new lower value 
-
-                // At this point the nextEvent for the neuron we pushed to should be update for the actionTime
-                // in the signal just pushed. This is a better alternative than scanning the signals.
-
-                // And now check globalNextEvent
-                (globalNextEvent < sigRef.actionTime + masterClock) ? globalNextEvent : sigRef.actionTime + masterClock;
+                m_neuronPool.activeNeurons.insert(targetNeuronId);     // Oct 2026: it has a signal pending
 
-                std::cout << "\nPrint incoming signals for targetNode:= " << std::to_string(m_connPool[connIdx].targetNeuronSlot);
+                TCN_TRACE(DEBUG, "\nPrint incoming signals for targetNode:= " << std::to_string(targetNeuronId));
 
-                for (int32_t idx : m_neuronPool[m_connPool[connIdx].targetNeuronSlot].incomingSignals)
+                if constexpr (trace::enabled<DEBUG>)
                 {
-                    std::cout << "\nsrb index:= " << std::to_string(idx);
-                    srbObj.printSignalFromIndex(idx);
+                    // full dump of the target queue on every push - debug builds only
+                    for (srb::SignalHandle queued : m_neuronPool.incomingSignals[targetNeuronId])
+                    {
+                        std::cout << "\nsrb index:= " << std::to_string(srb::handleSlot(queued));
+                        srbObj.printSignalFromIndex(srb::handleSlot(queued));
+                    }
                 }
-                
-                
-                return m_srb[nextSignalSlot].actionTime;    // this is the time for this signal event
             }
 
             void strengthen (std::int32_t connId)
@@ -364,10 +531,50 @@ namespace conns
              * @details:generateASignal adds to signal the sourceId of the connection that raised the signal.
              *          This is to support strenthening of a group of connections that contribute to a 
              *          neuron cascade and will be used in the future to support learning.
+             * 
+             *          Oct 2026: one stp tetanic pulse, or ltp once stp is saturated - see Learning.h.
+             *          The decay since the connection's last signal was applied when the fan-out stamped
+             *          it, so there is none to apply here. Signals injected from outside have no source
+             *          connection (sourceConnId 0, the proto connection, or negative) and are skipped.
+             */
+            {
+                if (connId <= 0)
+                {
+                    return;
+                }
+                if (connPoolPacked)
+                {
+                    learning::strengthen(m_connHot[connId], m_connCold[connId]);
+                }
+                else
+                {
+                    learning::strengthen(m_connPool[connId]);
+                }
+            }
+
+            void strengthen (const std::int32_t* first, const std::int32_t* last)
+            /**
+             * @brief:  strengthen() for a batch of connection ids sorted ascending - a tick's contributors.
+             * 
+             * @details:Oct 2026: the ids without a source connection sort to the front and are skipped in
+             *          one step, and the pool layout is decided once for the batch.
              */
             {
-                // do nothing for now
-                ;
+                first = std::upper_bound(first, last, 0);
+                if (connPoolPacked)
+                {
+                    for (; first != last; ++first)
+                    {
+                        learning::strengthen(m_connHot[*first], m_connCold[*first]);
+                    }
+                }
+                else
+                {
+                    for (; first != last; ++first)
+                    {
+                        learning::strengthen(m_connPool[*first]);
+                    }
+                }
             }
 
             /**
@@ -0,0 +1,307 @@
+#ifndef EVENTWHEEL_H_INCLUDED
+#define EVENTWHEEL_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+#include <vector>
+#include <utility>
+
+/**
+ * @brief EventWheel
+ *
+ * A two level hierarchical timing wheel (calendar queue) keyed on signal actionTime.
+ *
+ * @details Oct 2026: Replaces the full walk of m_neuronPool that scanNeuronsForSignals
+ * used to do on every clock tick just to find the handful of neurons whose nextEvent
+ * matched the masterClock. Connections::generateASignal now schedules the target neuron id
+ * here whenever a signal lowers the target's nextEvent, so each tick only visits neurons
+ * that actually have due signals and the masterClock can jump straight to the next
+ * non-empty bucket.
+ *
+ * Layout:
+ *  near wheel      - one bucket per clock tick for the current block of nearSize ticks.
+ *  far wheel       - one bucket per block of nearSize ticks for the next farSize blocks.
+ *  overflow        - anything further out than the far wheel can hold.
+ *
+ * When the clock moves into a new block the matching far bucket is cascaded into the near
+ * wheel. Overflow entries are pulled into the far wheel once they come within range.
+ *
+ * The wheel only holds neuron ids - it never owns signals. A neuron may be scheduled more
+ * than once (e.g. it's nextEvent was lowered after it was first scheduled). Stale entries are
+ * harmless as the scan only processes a neuron whose nextEvent equals the masterClock.
+ *
+ * All buckets are vectors that are cleared, not released, so after warm-up scheduling does
+ * not touch the heap.
+ */
+
+namespace wheel
+{
+    inline constexpr std::int32_t nearBits{8};
+    inline constexpr std::int32_t nearSize{1 << nearBits};      // 256 one tick buckets
+    inline constexpr std::int32_t nearMask{nearSize - 1};
+    inline constexpr std::int32_t farBits{8};
+    inline constexpr std::int32_t farSize{1 << farBits};        // 256 buckets of 256 ticks = 65536 ticks
+    inline constexpr std::int32_t farMask{farSize - 1};
+    inline constexpr std::int32_t bitmapWords{nearSize / 64};   // occupancy bitmaps, 64 buckets per word
+
+    struct WheelEntry {
+        std::int32_t neuronId;      // neuron to visit
+        std::int32_t actionTime;    // clock tick when it is due
+    };
+
+    class EventWheel
+    {
+        public:
+
+        EventWheel() : m_near(nearSize), m_far(farSize) {}
+
+        ~EventWheel()
+        {
+            ;   // bucket vectors are released when they go out of scope
+        }
+
+        std::int32_t wheelClock() const { return m_wheelClock; }
+        std::int64_t pending() const { return m_pending; }
+
+        void swap(EventWheel& other)
+        /**
+         * @brief Exchange contents with another wheel - the buckets change hands, nothing is copied.
+         */
+        {
+            m_near.swap(other.m_near);
+            m_far.swap(other.m_far);
+            m_overflow.swap(other.m_overflow);
+            std::swap(m_nearBits, other.m_nearBits);
+            std::swap(m_farBits, other.m_farBits);
+            std::swap(m_overflowMinTime, other.m_overflowMinTime);
+            std::swap(m_wheelClock, other.m_wheelClock);
+            std::swap(m_pending, other.m_pending);
+        }
+
+        void reset(std::int32_t clock)
+        /**
+         * @brief Drop everything and restart the wheel at the given clock.
+         */
+        {
+            for (auto& bucket : m_near) { bucket.clear(); }
+            for (auto& bucket : m_far)  { bucket.clear(); }
+            m_overflow.clear();
+            for (int w = 0; w < bitmapWords; ++w) { m_nearBits[w] = 0; m_farBits[w] = 0; }
+            m_overflowMinTime = INT32_MAX;
+            m_pending = 0;
+            m_wheelClock = clock;
+        }
+
+        void schedule(std::int32_t neuronId, std::int32_t actionTime)
+        /**
+         * @brief Enqueue a neuron to be visited at actionTime.
+         *
+         * @details Anything at or before the wheel clock is treated as due at the next
+         * collectDue() so nothing can be lost by being scheduled late.
+         */
+        {
+            if (actionTime < m_wheelClock)
+            {
+                actionTime = m_wheelClock;
+            }
+            ++m_pending;
+            std::int32_t block = actionTime >> nearBits;
+            std::int32_t currentBlock = m_wheelClock >> nearBits;
+
+            if (block == currentBlock)
+            {
+                std::int32_t slot = actionTime & nearMask;
+                m_near[slot].push_back(neuronId);
+                m_nearBits[slot >> 6] |= (std::uint64_t{1} << (slot & 63));
+            }
+            else if (block - currentBlock < farSize)
+            {
+                std::int32_t slot = block & farMask;
+                m_far[slot].push_back(WheelEntry{neuronId, actionTime});
+                m_farBits[slot >> 6] |= (std::uint64_t{1} << (slot & 63));
+            }
+            else
+            {
+                m_overflow.push_back(WheelEntry{neuronId, actionTime});
+                m_overflowMinTime = (actionTime < m_overflowMinTime) ? actionTime : m_overflowMinTime;
+            }
+        }
+
+        std::int32_t nextEventTime() const
+        /**
+         * @brief Clock tick of the earliest scheduled neuron, INT32_MAX if there is none.
+         */
+        {
+            if (m_pending == 0)
+            {
+                return INT32_MAX;
+            }
+            std::int32_t currentBlock = m_wheelClock >> nearBits;
+
+            std::int32_t slot = firstSetBit(m_nearBits, m_wheelClock & nearMask);
+            if (slot >= 0)
+            {
+                return (currentBlock << nearBits) | slot;
+            }
+
+            // far wheel is circular - look from the next block to the end, then wrap
+            std::int32_t startSlot = (currentBlock + 1) & farMask;
+            slot = firstSetBit(m_farBits, startSlot);
+            if (slot < 0 && startSlot != 0)
+            {
+                slot = firstSetBit(m_farBits, 0);
+            }
+            if (slot >= 0)
+            {
+                std::int32_t earliest{INT32_MAX};
+                for (const WheelEntry& e : m_far[slot])
+                {
+                    earliest = (e.actionTime < earliest) ? e.actionTime : earliest;
+                }
+                return earliest;
+            }
+            return m_overflowMinTime;
+        }
+
+        void collectDue(std::int32_t clock, std::vector<std::int32_t>& due)
+        /**
+         * @brief Move every neuron scheduled at or before clock into due and advance the wheel
+         * past clock.
+         *
+         * @details Callers normally advance the masterClock to nextEventTime() so there are no
+         * overdue entries, but if the clock jumps over events they are still handed back rather
+         * than dropped.
+         */
+        {
+            if (clock < m_wheelClock)
+            {
+                return;     // already collected
+            }
+            std::int32_t targetBlock = clock >> nearBits;
+
+            while ((m_wheelClock >> nearBits) < targetBlock)
+            {
+                drainNear(m_wheelClock & nearMask, nearMask, due);
+
+                std::int32_t nextBlock = (m_wheelClock >> nearBits) + 1;
+                if (m_pending == 0 || noFarEntries())
+                {
+                    // nothing in near or far - jump straight to where the clock is going
+                    // or to where the overflow starts, whichever comes first
+                    std::int32_t overflowBlock = (m_overflowMinTime == INT32_MAX) ?
+                                                    targetBlock : (m_overflowMinTime >> nearBits);
+                    nextBlock = (overflowBlock < targetBlock) ? overflowBlock : targetBlock;
+                    nextBlock = (nextBlock > (m_wheelClock >> nearBits)) ? nextBlock : (m_wheelClock >> nearBits) + 1;
+                }
+                m_wheelClock = nextBlock << nearBits;
+                refillNear();
+            }
+            drainNear(m_wheelClock & nearMask, clock & nearMask, due);
+
+            // the bucket for clock has now been handed out; any later scheduling at clock
+            // lands in the bucket for the next tick
+            m_wheelClock = clock + 1;
+            if ((m_wheelClock & nearMask) == 0)
+            {
+                refillNear();
+            }
+        }
+
+        private:
+
+        std::vector<std::vector<std::int32_t>> m_near;     // neuron ids per tick of current block
+        std::vector<std::vector<WheelEntry>> m_far;         // entries per future block
+        std::vector<WheelEntry> m_overflow;                 // beyond the far horizon
+        std::uint64_t m_nearBits[bitmapWords]{};            // occupancy of m_near buckets
+        std::uint64_t m_farBits[bitmapWords]{};             // occupancy of m_far buckets
+        std::int32_t m_overflowMinTime{INT32_MAX};
+        std::int32_t m_wheelClock{0};                       // first tick not yet collected
+        std::int64_t m_pending{0};                          // entries in the wheel
+
+        static std::int32_t firstSetBit(const std::uint64_t (&bits)[bitmapWords], std::int32_t from)
+        {
+            // first occupied bucket at or after from, -1 if none
+            std::int32_t word = from >> 6;
+            std::uint64_t masked = bits[word] & (~std::uint64_t{0} << (from & 63));
+            while (true)
+            {
+                if (masked != 0)
+                {
+                    return (word << 6) + __builtin_ctzll(masked);
+                }
+                if (++word >= bitmapWords)
+                {
+                    return -1;
+                }
+                masked = bits[word];
+            }
+        }
+
+        bool noFarEntries() const
+        {
+            for (int w = 0; w < bitmapWords; ++w)
+            {
+                if (m_farBits[w] != 0) { return false; }
+            }
+            return true;
+        }
+
+        void drainNear(std::int32_t fromSlot, std::int32_t toSlot, std::vector<std::int32_t>& due)
+        {
+            std::int32_t slot = firstSetBit(m_nearBits, fromSlot);
+            while (slot >= 0 && slot <= toSlot)
+            {
+                std::vector<std::int32_t>& bucket = m_near[slot];
+                due.insert(due.end(), bucket.begin(), bucket.end());
+                m_pending -= static_cast<std::int64_t>(bucket.size());
+                bucket.clear();
+                m_nearBits[slot >> 6] &= ~(std::uint64_t{1} << (slot & 63));
+                if (slot == nearMask)
+                {
+                    break;
+                }
+                slot = firstSetBit(m_nearBits, slot + 1);
+            }
+        }
+
+        void refillNear()
+        {
+            // cascade the far bucket for the block we just entered into the near wheel
+            std::int32_t currentBlock = m_wheelClock >> nearBits;
+            std::int32_t farSlot = currentBlock & farMask;
+            std::vector<WheelEntry>& bucket = m_far[farSlot];
+            if (!bucket.empty())
+            {
+                m_far[farSlot].swap(m_cascade);
+                m_farBits[farSlot >> 6] &= ~(std::uint64_t{1} << (farSlot & 63));
+                m_pending -= static_cast<std::int64_t>(m_cascade.size());
+                for (const WheelEntry& e : m_cascade)
+                {
+                    schedule(e.neuronId, e.actionTime);
+                }
+                m_cascade.clear();
+            }
+
+            // pull overflow entries that are now within range of the far wheel
+            if (m_overflowMinTime != INT32_MAX &&
+                (m_overflowMinTime >> nearBits) - currentBlock < farSize)
+            {
+                m_overflow.swap(m_cascade);
+                m_pending -= static_cast<std::int64_t>(m_cascade.size());
+                m_overflowMinTime = INT32_MAX;
+                for (const WheelEntry& e : m_cascade)
+                {
+                    schedule(e.neuronId, e.actionTime);
+                }
+                m_cascade.clear();
+            }
+        }
+
+        std::vector<WheelEntry> m_cascade;  // scratch used while cascading buckets
+    };
+}   // end wheel namespace
+
+// Global wheel used by the neuron scan - same single-TCN convention as the pools
+wheel::EventWheel eventWheel{};
+
+#endif // EVENTWHEEL_H_INCLUDED
@@ -0,0 +1,296 @@
+#ifndef FANOUTKERNEL_H_INCLUDED
+#define FANOUTKERNEL_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "Connection.h"
+#include "Learning.h"
+#include "TickPartitions.h"
+
+/**
+ * @brief FanOutKernel
+ *
+ * The inner loop of every cascade: turn a neuron's slice of the CSR fan-out into signal
+ * Deliveries, eight connections at a time.
+ *
+ * @details Oct 2026: For each connection the kernel works out
+ *      actionTime  = clock + temporalDistanceToTarget
+ *      amplitude   = stpWeight + ltpWeight
+ *      live        = targetNeuronSlot >= 0
+ * for a whole batch in vector lanes, appends a Delivery for each live lane in fan-out order,
+ * stamps those connections' lastSignalOriginTime and keeps a per lane minimum of the live action
+ * times that is reduced to one earliest actionTime per call rather than once per signal.
+ *
+ * The path is picked at build time: with __AVX2__ (-mavx2, -march=haswell or newer) the
+ * connection fields are gathered straight out of the connection pool into 256 bit registers;
+ * otherwise the same batches run through plain loops the compiler can vectorize as it sees fit.
+ * The short tail of a fan-out always takes the plain loop. Both give exactly the same Deliveries.
+ *
+ * Every connection with a target is live. There is no refractory test here: the cascading
+ * neuron's own refractoryEnd, which collectOutgoingSignals used to test, is always before the
+ * masterClock when it cascades, and the target's is not the fan-out's to read - another
+ * partition may be cascading it this very tick. A target ignores signals due within its
+ * refractory period when it aggregates (Neurons::aggregationWindowStart).
+ *
+ * Oct 2026: Each kernel also comes in a packed pool version (connection::HotConnection and
+ * ColdConnection) that gathers one word for target and distance and stamps lastSignalOriginTime
+ * in the cold array.
+ *
+ * Oct 2026: Learning. A live connection is aged (learning::age) as it is stamped when a line of
+ * the stp or ltp decay grid has passed since its last signal. The amplitude is therefore read lane by
+ * lane as each live connection is stamped - the record is in cache for the stamp anyway - rather
+ * than gathered for every lane; ageing never changes which lanes are live.
+ */
+
+namespace fanout
+{
+    inline constexpr std::int32_t batchWidth{8};    // int32 lanes in one AVX2 register
+
+    // Connection field offsets in int32 words - the gathers index the pool as an int32 array
+    inline constexpr std::int32_t targetWord{0};    // targetNeuronSlot
+    inline constexpr std::int32_t distanceWord{2};  // temporalDistanceToTarget
+    inline constexpr std::int32_t connectionWords{static_cast<std::int32_t>(sizeof(connection::Connection) / 4)};
+
+    static_assert(sizeof(connection::Connection) == 16 && connectionWords == 4,
+                  "fan-out gathers assume the 16 byte Connection layout");
+
+    // packed pool: the hot record as 16 bit units - the gathers index it with scale 2
+    inline constexpr std::int32_t hotUnits{static_cast<std::int32_t>(sizeof(connection::HotConnection) / 2)};
+
+    static_assert(hotUnits == 3, "packed fan-out gathers assume the 6 byte HotConnection layout");
+
+    struct PackedPool {
+        connection::HotConnection* hot;
+        connection::ColdConnection* cold;
+    };
+
+    inline std::int16_t stamp(connection::Connection* connPool, std::int32_t connId, std::int32_t clock)
+    {
+        // lazy stp/ltp decay, then the stamp it is measured from; the amplitude to signal with
+        connection::Connection& conn = connPool[connId];
+        if (learning::due(clock, conn.lastSignalOriginTime))
+        {
+            learning::age(conn, clock);
+        }
+        conn.lastSignalOriginTime = clock;
+        return static_cast<std::int16_t>(conn.stpWeight + conn.ltpWeight);
+    }
+
+    inline std::int16_t stamp(PackedPool connPool, std::int32_t connId, std::int32_t clock)
+    {
+        connection::ColdConnection& cold = connPool.cold[connId];
+        if (learning::due(clock, cold.lastSignalOriginTime))
+        {
+            learning::age(connPool.hot[connId], cold, clock);
+        }
+        cold.lastSignalOriginTime = clock;
+        return connPool.hot[connId].weight;
+    }
+
+    template <typename Pool>
+    inline void emitLanes(const std::int32_t* connIds, std::uint32_t liveMask,
+                          const std::int32_t* target, const std::int32_t* actionTime, Pool connPool, std::int32_t clock, std::vector<tick::Delivery>& outbox)
+    {
+        // connPool is a Connection pointer or a PackedPool
+        // live lanes in fan-out order; collect() has made room for every lane already
+        while (liveMask != 0)
+        {
+            std::int32_t lane = __builtin_ctz(liveMask);
+            liveMask &= liveMask - 1;
+            std::int16_t amplitude = stamp(connPool, connIds[lane], clock);
+            outbox.push_back(tick::Delivery{connIds[lane], target[lane], actionTime[lane], amplitude});
+        }
+    }
+
+    inline std::int32_t collectScalar(const std::int32_t* first, const std::int32_t* last,
+                                      connection::Connection* connPool, std::int32_t clock, std::vector<tick::Delivery>& outbox)
+    /**
+     * @brief Plain loop version of collect() - the fallback and the tail.
+     */
+    {
+        std::int32_t earliest{INT32_MAX};
+        std::int32_t target[batchWidth];
+        std::int32_t actionTime[batchWidth];
+        for (; first < last; first += batchWidth)
+        {
+            std::int32_t lanes = (last - first < batchWidth) ? static_cast<std::int32_t>(last - first) : batchWidth;
+            std::uint32_t liveMask{0};
+            for (std::int32_t lane = 0; lane < lanes; ++lane)
+            {
+                const connection::Connection& conn = connPool[first[lane]];
+                target[lane] = conn.targetNeuronSlot;
+                actionTime[lane] = clock + conn.temporalDistanceToTarget;
+                bool live = target[lane] >= 0;
+                liveMask |= static_cast<std::uint32_t>(live) << lane;
+                earliest = (live && actionTime[lane] < earliest) ? actionTime[lane] : earliest;
+            }
+            emitLanes(first, liveMask, target, actionTime, connPool, clock, outbox);
+        }
+        return earliest;
+    }
+
+#ifdef __AVX2__
+    inline std::int32_t collectAVX2(const std::int32_t* first, const std::int32_t* last,
+                                    connection::Connection* connPool, std::int32_t clock, std::vector<tick::Delivery>& outbox)
+    {
+        const int* pool = reinterpret_cast<const int*>(connPool);
+        const __m256i clocks = _mm256_set1_epi32(clock);
+        const __m256i noTarget = _mm256_set1_epi32(-1);
+        const __m256i never = _mm256_set1_epi32(INT32_MAX);
+        __m256i earliest = never;
+
+        alignas(32) std::int32_t target[batchWidth];
+        alignas(32) std::int32_t actionTime[batchWidth];
+        for (; last - first >= batchWidth; first += batchWidth)
+        {
+            __m256i words = _mm256_slli_epi32(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), 2);   // connId * connectionWords
+            __m256i targets = _mm256_i32gather_epi32(pool + targetWord, words, 4);
+            __m256i times = _mm256_add_epi32(clocks, _mm256_i32gather_epi32(pool + distanceWord, words, 4));
+            __m256i live = _mm256_cmpgt_epi32(targets, noTarget);
+            earliest = _mm256_min_epi32(earliest, _mm256_blendv_epi8(never, times, live));
+
+            std::uint32_t liveMask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(live)));
+            if (liveMask != 0)
+            {
+                _mm256_store_si256(reinterpret_cast<__m256i*>(target), targets);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(actionTime), times);
+                emitLanes(first, liveMask, target, actionTime, connPool, clock, outbox);
+            }
+        }
+
+        // one horizontal reduction per call
+        __m128i lanes4 = _mm_min_epi32(_mm256_castsi256_si128(earliest), _mm256_extracti128_si256(earliest, 1));
+        lanes4 = _mm_min_epi32(lanes4, _mm_shuffle_epi32(lanes4, _MM_SHUFFLE(1, 0, 3, 2)));
+        lanes4 = _mm_min_epi32(lanes4, _mm_shuffle_epi32(lanes4, _MM_SHUFFLE(2, 3, 0, 1)));
+        std::int32_t vectorEarliest = _mm_cvtsi128_si32(lanes4);
+
+        std::int32_t tailEarliest = collectScalar(first, last, connPool, clock, outbox);
+        return (tailEarliest < vectorEarliest) ? tailEarliest : vectorEarliest;
+    }
+#endif
+
+    inline std::int32_t collect(const std::int32_t* first, const std::int32_t* last,
+                                connection::Connection* connPool, std::int32_t clock, std::vector<tick::Delivery>& outbox)
+    /**
+     * @brief Append a Delivery to outbox for every live connection id in [first, last), age it
+     * and stamp its lastSignalOriginTime with clock.
+     *
+     * @return  the earliest actionTime appended, INT32_MAX if none
+     */
+    {
+        // one growth check per fan-out, still doubling so a tick's outbox grows geometrically
+        std::size_t needed = outbox.size() + static_cast<std::size_t>(last - first);
+        if (needed > outbox.capacity())
+        {
+            outbox.reserve((needed > 2 * outbox.capacity()) ? needed : 2 * outbox.capacity());
+        }
+#ifdef __AVX2__
+        return collectAVX2(first, last, connPool, clock, outbox);
+#else
+        return collectScalar(first, last, connPool, clock, outbox);
+#endif
+    }
+
+    inline std::int32_t collectScalar(const std::int32_t* first, const std::int32_t* last,
+                                      connection::HotConnection* hot, connection::ColdConnection* cold,
+                                      std::int32_t clock, std::vector<tick::Delivery>& outbox)
+    /**
+     * @brief collectScalar() over the packed pool.
+     */
+    {
+        std::int32_t earliest{INT32_MAX};
+        std::int32_t target[batchWidth];
+        std::int32_t actionTime[batchWidth];
+        for (; first < last; first += batchWidth)
+        {
+            std::int32_t lanes = (last - first < batchWidth) ? static_cast<std::int32_t>(last - first) : batchWidth;
+            std::uint32_t liveMask{0};
+            for (std::int32_t lane = 0; lane < lanes; ++lane)
+            {
+                const connection::HotConnection& conn = hot[first[lane]];
+                target[lane] = connection::packedTarget(conn);
+                actionTime[lane] = clock + connection::packedDistance(conn);
+                bool live = target[lane] >= 0;
+                liveMask |= static_cast<std::uint32_t>(live) << lane;
+                earliest = (live && actionTime[lane] < earliest) ? actionTime[lane] : earliest;
+            }
+            emitLanes(first, liveMask, target, actionTime, PackedPool{hot, cold}, clock, outbox);
+        }
+        return earliest;
+    }
+
+#ifdef __AVX2__
+    inline std::int32_t collectAVX2(const std::int32_t* first, const std::int32_t* last,
+                                    connection::HotConnection* hot, connection::ColdConnection* cold,
+                                    std::int32_t clock, std::vector<tick::Delivery>& outbox)
+    {
+        // one gather per batch - target and distance share a word
+        const int* pool = reinterpret_cast<const int*>(hot);
+        const __m256i clocks = _mm256_set1_epi32(clock);
+        const __m256i noTarget = _mm256_set1_epi32(static_cast<int>(connection::noPackedTarget));
+        const __m256i allLanes = _mm256_set1_epi32(-1);
+        const __m256i distanceMask = _mm256_set1_epi32(static_cast<int>(connection::packedDistanceMask));
+        const __m256i never = _mm256_set1_epi32(INT32_MAX);
+        __m256i earliest = never;
+
+        alignas(32) std::int32_t target[batchWidth];
+        alignas(32) std::int32_t actionTime[batchWidth];
+        for (; last - first >= batchWidth; first += batchWidth)
+        {
+            __m256i ids = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i units = _mm256_add_epi32(_mm256_slli_epi32(ids, 1), ids);      // connId * hotUnits
+            __m256i words = _mm256_i32gather_epi32(pool, units, 2);
+            __m256i targets = _mm256_srli_epi32(words, connection::packedDistanceBits);
+            __m256i times = _mm256_add_epi32(clocks, _mm256_and_si256(words, distanceMask));
+            __m256i live = _mm256_andnot_si256(_mm256_cmpeq_epi32(targets, noTarget), allLanes);
+            earliest = _mm256_min_epi32(earliest, _mm256_blendv_epi8(never, times, live));
+
+            std::uint32_t liveMask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(live)));
+            if (liveMask != 0)
+            {
+                _mm256_store_si256(reinterpret_cast<__m256i*>(target), targets);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(actionTime), times);
+                emitLanes(first, liveMask, target, actionTime, PackedPool{hot, cold}, clock, outbox);
+            }
+        }
+
+        __m128i lanes4 = _mm_min_epi32(_mm256_castsi256_si128(earliest), _mm256_extracti128_si256(earliest, 1));
+        lanes4 = _mm_min_epi32(lanes4, _mm_shuffle_epi32(lanes4, _MM_SHUFFLE(1, 0, 3, 2)));
+        lanes4 = _mm_min_epi32(lanes4, _mm_shuffle_epi32(lanes4, _MM_SHUFFLE(2, 3, 0, 1)));
+        std::int32_t vectorEarliest = _mm_cvtsi128_si32(lanes4);
+
+        std::int32_t tailEarliest = collectScalar(first, last, hot, cold, clock, outbox);
+        return (tailEarliest < vectorEarliest) ? tailEarliest : vectorEarliest;
+    }
+#endif
+
+    inline std::int32_t collect(const std::int32_t* first, const std::int32_t* last,
+                                connection::HotConnection* hot, connection::ColdConnection* cold,
+                                std::int32_t clock, std::vector<tick::Delivery>& outbox)
+    /**
+     * @brief collect() over the packed pool - the same Deliveries, stamps in the cold array.
+     */
+    {
+        std::size_t needed = outbox.size() + static_cast<std::size_t>(last - first);
+        if (needed > outbox.capacity())
+        {
+            outbox.reserve((needed > 2 * outbox.capacity()) ? needed : 2 * outbox.capacity());
+        }
+#ifdef __AVX2__
+        return collectAVX2(first, last, hot, cold, clock, outbox);
+#else
+        return collectScalar(first, last, hot, cold, clock, outbox);
+#endif
+    }
+
+}   // end fanout namespace
+
+#endif // FANOUTKERNEL_H_INCLUDED
@@ -0,0 +1,156 @@
+#ifndef LEARNING_H_INCLUDED
+#define LEARNING_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+
+#include "TCNConstants.h"
+#include "Connection.h"
+
+/**
+ * @brief Learning
+ *
+ * STP/LTP group strengthening of the connections that caused a cascade, and the decay of that
+ * strengthening with disuse.
+ *
+ * @details Oct 2026: A connection's weights move in magnitude only - an inhibitory connection
+ * (negative stpWeight) is strengthened and decays exactly as an excitatory one, with the sign kept.
+ *      stp     base_signal_size .. stp_signal_limit, +stp_units_per_tetanic_pulse per strengthening,
+ *              one unit back toward base_signal_size every stp_unit_decay_interval ticks
+ *      ltp     0 .. ltp_signal_limit - base_signal_size, +ltp_units_per_tetanic_pulse per
+ *              strengthening once stp is at its limit, one unit back toward 0 every
+ *              ltp_unit_decay_interval ticks
+ * An stp weight beyond stp_signal_limit (set by hand, say) is not strengthened further and
+ * decays back toward base_signal_size like any other.
+ *
+ * Every limit, interval and pulse size above is a tcnconstants value in TCNConstants.h; the
+ * floor and ceilings below are only renamed from them.
+ *
+ * Decay is lazy: nothing sweeps the pool. Decay runs on a fixed grid on the clock - every multiple
+ * of stp_unit_decay_interval takes one stp unit off, every multiple of ltp_unit_decay_interval one
+ * ltp unit - and a connection is aged when it is next used, by the fan-out just before its
+ * lastSignalOriginTime is stamped, by the grid lines crossed since that stamp. The part interval a
+ * stamp leaves behind is therefore never lost: the line counts telescope, so a connection used
+ * every few ticks decays by exactly as many units as one left alone for the same time. Learning
+ * costs O(signals), not O(connections x time), and needs no field beyond the stamp. The unit decay
+ * is linear, so the decay for any elapsed time is two constant divisions (a multiply and shift)
+ * per weight; there is no table to build or keep in cache.
+ */
+
+namespace learning
+{
+    namespace tconst = tcnconstants;
+
+    inline constexpr std::int32_t stpFloor{tconst::base_signal_size};
+    inline constexpr std::int32_t stpCeiling{tconst::stp_signal_limit};
+    inline constexpr std::int32_t ltpCeiling{tconst::ltp_signal_limit - tconst::base_signal_size};
+
+    static_assert(stpCeiling + ltpCeiling <= INT16_MAX, "a fully strengthened connection must fit an int16 weight");
+
+    inline std::int64_t gridLine(std::int64_t clock, std::int32_t interval)
+    {
+        // the last multiple of interval at or before clock, counted from 0; floor division as a
+        // blank or hand made stamp may be anywhere in the int32 range
+        return (clock >= 0) ? clock / interval : -((interval - 1 - clock) / interval);
+    }
+
+    inline std::int64_t unitsDue(std::int32_t clock, std::int32_t lastSignalOriginTime, std::int32_t interval)
+    {
+        // decay units for one weight: the grid lines in (lastSignalOriginTime, clock]
+        return gridLine(clock, interval) - gridLine(lastSignalOriginTime, interval);
+    }
+
+    inline bool due(std::int32_t clock, std::int32_t lastSignalOriginTime)
+    {
+        return unitsDue(clock, lastSignalOriginTime, tconst::stp_unit_decay_interval) > 0 ||
+               unitsDue(clock, lastSignalOriginTime, tconst::ltp_unit_decay_interval) > 0;
+    }
+
+    inline std::int32_t magnitude(std::int32_t weight)
+    {
+        return (weight < 0) ? -weight : weight;
+    }
+
+    inline std::int16_t signedLike(std::int32_t sign, std::int32_t value)
+    {
+        return static_cast<std::int16_t>((sign < 0) ? -value : value);
+    }
+
+    inline std::int16_t decayedStp(std::int16_t stp, std::int64_t units)
+    {
+        std::int32_t size = magnitude(stp);
+        if (size <= stpFloor || units <= 0)
+        {
+            return stp;
+        }
+        return signedLike(stp, (units >= size - stpFloor) ? stpFloor : size - static_cast<std::int32_t>(units));
+    }
+
+    inline std::int16_t decayedLtp(std::int16_t ltp, std::int64_t units)
+    {
+        std::int32_t size = magnitude(ltp);
+        if (units <= 0)
+        {
+            return ltp;
+        }
+        return signedLike(ltp, (units >= size) ? 0 : size - static_cast<std::int32_t>(units));
+    }
+
+    inline void strengthened(std::int16_t& stp, std::int16_t& ltp)
+    {
+        // one tetanic pulse; ltp only grows once stp is saturated and never past an int16 amplitude
+        std::int32_t stpSize = magnitude(stp);
+        std::int32_t ltpSize = magnitude(ltp);
+        if (stpSize >= stpCeiling)
+        {
+            std::int32_t ceiling = (ltpCeiling < INT16_MAX - stpSize) ? ltpCeiling : INT16_MAX - stpSize;
+            std::int32_t grown = ltpSize + tconst::ltp_units_per_tetanic_pulse;
+            ltp = (ltpSize >= ceiling) ? ltp : signedLike(stp, (grown > ceiling) ? ceiling : grown);
+        }
+        else
+        {
+            std::int32_t grown = stpSize + tconst::stp_units_per_tetanic_pulse;
+            stp = signedLike(stp, (grown > stpCeiling) ? stpCeiling : grown);
+        }
+    }
+
+    inline std::int32_t age(connection::Connection& conn, std::int32_t clock)
+    /**
+     * @brief Apply the decay due since conn.lastSignalOriginTime; the caller has checked due().
+     *
+     * @return  the amplitude the connection signals with now
+     */
+    {
+        const std::int32_t last = conn.lastSignalOriginTime;
+        conn.stpWeight = decayedStp(conn.stpWeight, unitsDue(clock, last, tconst::stp_unit_decay_interval));
+        conn.ltpWeight = decayedLtp(conn.ltpWeight, unitsDue(clock, last, tconst::ltp_unit_decay_interval));
+        return conn.stpWeight + conn.ltpWeight;
+    }
+
+    inline std::int32_t age(connection::HotConnection& hot, connection::ColdConnection& cold, std::int32_t clock)
+    {
+        // age() for the packed pool - the weight is stp + ltp, stp is not stored
+        const std::int32_t last = cold.lastSignalOriginTime;
+        std::int16_t ltp = decayedLtp(cold.ltpWeight, unitsDue(clock, last, tconst::ltp_unit_decay_interval));
+        std::int16_t stp = decayedStp(static_cast<std::int16_t>(hot.weight - cold.ltpWeight),
+                                      unitsDue(clock, last, tconst::stp_unit_decay_interval));
+        cold.ltpWeight = ltp;
+        hot.weight = static_cast<std::int16_t>(stp + ltp);
+        return hot.weight;
+    }
+
+    inline void strengthen(connection::Connection& conn)
+    {
+        strengthened(conn.stpWeight, conn.ltpWeight);
+    }
+
+    inline void strengthen(connection::HotConnection& hot, connection::ColdConnection& cold)
+    {
+        std::int16_t stp = static_cast<std::int16_t>(hot.weight - cold.ltpWeight);
+        strengthened(stp, cold.ltpWeight);
+        hot.weight = static_cast<std::int16_t>(stp + cold.ltpWeight);
+    }
+
+}   // end learning namespace
+
+#endif // LEARNING_H_INCLUDED
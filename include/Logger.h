@@ -7,6 +7,7 @@
 #include <iomanip>
 #include <ctime>
 #include <time.h>
+#include <sstream>
 
 enum LogLevel {
     DEBUG,
@@ -15,7 +16,6 @@ enum LogLevel {
     ERROR,
     CRITICAL
 };
-#endif // LOGGER_H_DF
 
 /**
  *     Logger logger(INFO, "application.log"); // Log INFO and above to console and file
@@ -91,5 +91,4 @@ private:
     std::ofstream m_outputFile;
 };
 
-
-
+#endif // LOGGER_H_DF
@@ -0,0 +1,347 @@
+#ifndef NETWORKBUILDER_H_INCLUDED
+#define NETWORKBUILDER_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "TCNConstants.h"
+#include "TCNTopology.h"
+#include "Connection.h"
+#include "Neuron.h"
+#include "WorkerPool.h"
+
+extern std::vector<connection::Connection> m_connPool;
+extern std::int32_t currentConnectionSlot;
+extern std::int32_t connectionPoolCapacity;
+extern bool connPoolPacked;
+extern neuron::NeuronPool m_neuronPool;
+extern workers::WorkerPool tickWorkers;
+
+/**
+ * @brief NetworkBuilder
+ *
+ * Lays down the connections of a TCN - the five builders aTCN declared but never implemented -
+ * straight into m_connPool and the neuron pool's CSR fan-out.
+ *
+ * @details Oct 2026: Every neuron's connections come from five families, each with a range of
+ * candidate targets worked out from its topology::NeuronCoord:
+ *    ForwardVerticalBranched       every neuron of the parent SixPack, one visual layer up (Purkinje)
+ *    BackwardVerticalBranched      every neuron of the fanOut child SixPacks one layer down (Purkinje)
+ *    ForwardVerticalInterconnect   the next SixPack layer (L1 -> L2 ..) of its own SixPack (Pyramidal)
+ *    BackwardVerticalInterconnect  the previous SixPack layer of its own SixPack (Pyramidal)
+ *    HorizontalInterconnect        the rest of its own SixPack layer
+ * Because of the topology's layout each candidate set is one contiguous range of neuron ids.
+ *
+ * The densities split a neuron's connectionsPerNeuron between the families (largest remainder,
+ * so the shares always add up); the defaults are the VIT .. L6 densities and inhibition ratios
+ * from tcnconstants, in the order aTCN::buildConnectionNetwork used them. A family with no
+ * candidates - forward branched from IT, backward branched from V1, ... - adds nothing, so edge
+ * neurons have fewer connections. The inhibition ratio is the share of a family's connections
+ * that start with a negative weight.
+ *
+ * Targets, inhibition and temporal jitter come from a counter-based generator: every connection
+ * is one draw keyed by (seed, family, neuron, index), so no thread ever shares generator state
+ * and the network is identical for any thread count. The build is two passes over the neurons,
+ * both spread over a WorkerPool: count each neuron's fan-out, prefix sum, then every neuron
+ * writes its connections into its own contiguous slice of m_connPool and its own CSR row. A
+ * neuron's connections are adjacent in the pool, which keeps the fan-out kernel's gathers local.
+ */
+
+namespace netbuild
+{
+    namespace tconst = tcnconstants;
+
+    enum class Family : std::int32_t {
+        ForwardVerticalBranched = 0,
+        BackwardVerticalBranched = 1,
+        ForwardVerticalInterconnect = 2,
+        BackwardVerticalInterconnect = 3,
+        HorizontalInterconnect = 4
+    };
+
+    inline constexpr std::int32_t familyCount{5};
+    inline constexpr std::uint32_t allFamilies{(1u << familyCount) - 1};
+    inline constexpr std::int32_t neuronsPerTask{4096};
+
+    struct FamilySpec {
+        float density;              // share of connectionsPerNeuron, relative to the other families
+        float inhibitionRatio;      // share of the family's connections that are inhibitory
+        std::int32_t distance;      // temporal distance before jitter
+    };
+
+    struct BuildSpec {
+        std::uint64_t seed{20261017};
+        std::int32_t connectionsPerNeuron{tconst::neuron_connection_ratio};
+        std::int16_t weight{tconst::base_signal_size};        // stpWeight of an excitatory connection
+        std::array<FamilySpec, familyCount> families{{
+            {tconst::VIT_density, tconst::VIT_inhibition_ratio, tconst::branched_distance},
+            {tconst::V4_density, tconst::V4_inhibition_ratio, tconst::branched_distance},
+            {tconst::V2_density, tconst::V2_inhibition_ratio, tconst::interconnect_distance},
+            {tconst::V1_density, tconst::V1_inhibition_ratio, tconst::interconnect_distance},
+            {tconst::L6_density, tconst::L6_inhibition_ratio, tconst::horizontal_distance}
+        }};
+    };
+
+    struct TargetRange {
+        std::int32_t first;         // lowest candidate neuron id
+        std::int32_t count;         // candidates, the source itself included for horizontal
+    };
+
+    constexpr std::uint64_t mix(std::uint64_t z)
+    {
+        // splitmix64 finalizer
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    constexpr std::uint64_t draw(std::uint64_t seed, Family family, std::int32_t neuronId, std::int32_t index)
+    {
+        // the random bits for one connection, a pure function of its key
+        std::uint64_t counter = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(neuronId)) << 32) |
+                                (static_cast<std::uint64_t>(family) << 24) | static_cast<std::uint32_t>(index);
+        return mix(seed + (counter + 1) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    inline std::array<std::int32_t, familyCount> familyShares(const BuildSpec& spec)
+    {
+        // connectionsPerNeuron split by density, largest remainder first, ties to the lower family
+        float total{0.0f};
+        for (const FamilySpec& family : spec.families)
+        {
+            total += (family.density > 0.0f) ? family.density : 0.0f;
+        }
+        std::array<std::int32_t, familyCount> shares{};
+        std::array<float, familyCount> remainders{};
+        std::int32_t given{0};
+        for (std::int32_t f = 0; f < familyCount && total > 0.0f; ++f)
+        {
+            float exact = (spec.families[f].density > 0.0f) ? spec.connectionsPerNeuron * spec.families[f].density / total : 0.0f;
+            shares[f] = static_cast<std::int32_t>(exact);
+            remainders[f] = exact - shares[f];
+            given += shares[f];
+        }
+        for (; given < spec.connectionsPerNeuron && total > 0.0f; ++given)
+        {
+            std::int32_t largest = static_cast<std::int32_t>(std::max_element(remainders.begin(), remainders.end()) - remainders.begin());
+            ++shares[largest];
+            remainders[largest] = -1.0f;
+        }
+        return shares;
+    }
+
+    template <typename Topology>
+    TargetRange candidates(const Topology& topology, Family family, const topology::NeuronCoord& coord)
+    {
+        // the targets one family may reach from coord; count 0 when there are none
+        const std::int32_t v = static_cast<std::int32_t>(coord.vLayer);
+        const std::int32_t packOrigin = topology.sixPackOrigin(coord.vLayer, coord.sixPack);
+        const topology::Shape& shape = topology.layout.shape;
+        switch (family)
+        {
+            case Family::ForwardVerticalBranched:
+                return (v == 0) ? TargetRange{0, 0} :
+                    TargetRange{topology.sixPackOrigin(static_cast<topology::VLayer>(v - 1), coord.sixPack / topology.fanOut),
+                                topology.sixPackSize};
+            case Family::BackwardVerticalBranched:
+                return (v + 1 == topology::vLayerCount) ? TargetRange{0, 0} :
+                    TargetRange{topology.sixPackOrigin(static_cast<topology::VLayer>(v + 1), coord.sixPack * topology.fanOut),
+                                topology.sixPackSize * topology.fanOut};
+            case Family::ForwardVerticalInterconnect:
+                return (coord.packLayer + 1 == topology::packLayerCount) ? TargetRange{0, 0} :
+                    TargetRange{packOrigin + shape.layerOffset(coord.packLayer + 1), shape.layerSize(coord.packLayer + 1)};
+            case Family::BackwardVerticalInterconnect:
+                return (coord.packLayer == 0) ? TargetRange{0, 0} :
+                    TargetRange{packOrigin + shape.layerOffset(coord.packLayer - 1), shape.layerSize(coord.packLayer - 1)};
+            case Family::HorizontalInterconnect:
+                return (shape.layerSize(coord.packLayer) < 2) ? TargetRange{0, 0} :
+                    TargetRange{packOrigin + shape.layerOffset(coord.packLayer), shape.layerSize(coord.packLayer)};
+        }
+        return TargetRange{0, 0};
+    }
+
+    template <typename Topology>
+    std::int64_t build(const Topology& topology, const BuildSpec& spec = BuildSpec{},
+                       std::uint32_t families = allFamilies, workers::WorkerPool& workers = tickWorkers)
+    {
+        /**
+         * @brief Add the connections of the chosen families for every neuron of topology.
+         *
+         * @param   topology    topology::TCNTopology or DynamicTopology the neuron pool was sized by
+         * @param   spec        seed, connections per neuron and the per family parameters
+         * @param   families    bit mask, 1 << Family
+         * @param   workers     threads for both passes; the result does not depend on them
+         *
+         * @return  connections added
+         *
+         * @details New connections take the pool slots after currentConnectionSlot, neuron by
+         * neuron, and the pool grows (with blank entries) when it is too small. Fan-out already
+         * in the CSR is kept and the new connections follow it, as buildOutgoingIndex() does.
+         *
+         * @throws  std::invalid_argument if the neuron pool is not the topology's size
+         * @throws  std::invalid_argument if a chosen family's distance, jitter included, is not a
+         *          connection::validDistance - beyond srb::maxSignalDistance its signals could not be timed
+         * @throws  std::length_error if the connection indices would overflow an int32
+         * @throws  std::logic_error if the connection pool is packed - build first, then pack
+         */
+        const std::int32_t neuronCount = topology.neuronCount;
+        if (connPoolPacked)
+        {
+            throw std::logic_error("netbuild: the connection pool is packed; unpackPool() before building");
+        }
+        if (m_neuronPool.size() != neuronCount)
+        {
+            throw std::invalid_argument("netbuild: neuron pool has " + std::to_string(m_neuronPool.size()) +
+                                        " neurons, the topology " + std::to_string(neuronCount));
+        }
+        for (std::int32_t f = 0; f < familyCount; ++f)
+        {
+            const std::int32_t distance = spec.families[f].distance;
+            if (((families >> f) & 1u) &&
+                !(connection::validDistance(distance) && connection::validDistance(distance + tconst::distance_jitter - 1)))
+            {
+                throw std::invalid_argument("netbuild: family " + std::to_string(f) + " distance " + std::to_string(distance) +
+                                            " is outside the temporal distances a signal can carry");
+            }
+        }
+        m_neuronPool.buildOutgoingIndex();      // anything still staged goes ahead of the new fan-out
+
+        const std::array<std::int32_t, familyCount> shares = familyShares(spec);
+        const std::int32_t tasks = (neuronCount + neuronsPerTask - 1) / neuronsPerTask;
+
+        // pass 1: fan-out of every neuron
+        std::vector<std::int32_t> added(static_cast<std::size_t>(neuronCount) + 1, 0);
+        workers.run(tasks, [&](std::int32_t task)
+        {
+            const std::int32_t last = std::min(neuronCount, (task + 1) * neuronsPerTask);
+            for (std::int32_t n = task * neuronsPerTask; n < last; ++n)
+            {
+                const topology::NeuronCoord coord = topology.locate(n);
+                std::int32_t count{0};
+                for (std::int32_t f = 0; f < familyCount; ++f)
+                {
+                    bool chosen = (families >> f) & 1u;
+                    count += (chosen && candidates(topology, static_cast<Family>(f), coord).count > 0) ? shares[f] : 0;
+                }
+                added[n + 1] = count;
+            }
+        });
+
+        // prefix sums: new connections alone, and the merged CSR rows
+        std::int64_t total{0};
+        for (std::int32_t n = 1; n <= neuronCount; ++n)
+        {
+            total += added[n];
+        }
+        const std::int64_t firstConnection = static_cast<std::int64_t>(currentConnectionSlot) + 1;
+        if (firstConnection + total > INT32_MAX || static_cast<std::int64_t>(m_neuronPool.outgoingSignals.size()) + total > INT32_MAX)
+        {
+            throw std::length_error("netbuild: " + std::to_string(total) + " connections overflow the connection indices");
+        }
+        std::vector<std::int32_t> offsets(static_cast<std::size_t>(neuronCount) + 1, 0);
+        for (std::int32_t n = 0; n < neuronCount; ++n)
+        {
+            std::int32_t existing = m_neuronPool.outgoingOffsets[n + 1] - m_neuronPool.outgoingOffsets[n];
+            offsets[n + 1] = offsets[n] + existing + added[n + 1];
+            added[n + 1] += added[n];
+        }
+        if (static_cast<std::int64_t>(m_connPool.size()) < firstConnection + total)
+        {
+            m_connPool.resize(static_cast<std::size_t>(firstConnection + total), connection::Connection{-1, -1, -1, -1, -1});
+            connectionPoolCapacity = static_cast<std::int32_t>(m_connPool.size());
+        }
+
+        // pass 2: every neuron fills its own pool slice and CSR row
+        std::vector<std::int32_t> flat(static_cast<std::size_t>(offsets[neuronCount]));
+        workers.run(tasks, [&](std::int32_t task)
+        {
+            const std::int32_t last = std::min(neuronCount, (task + 1) * neuronsPerTask);
+            for (std::int32_t n = task * neuronsPerTask; n < last; ++n)
+            {
+                std::int32_t* row = flat.data() + offsets[n];
+                for (const std::int32_t connIdx : m_neuronPool.outgoing(n))
+                {
+                    *row++ = connIdx;
+                }
+                std::int32_t connIdx = static_cast<std::int32_t>(firstConnection) + added[n];
+                const topology::NeuronCoord coord = topology.locate(n);
+                for (std::int32_t f = 0; f < familyCount; ++f)
+                {
+                    const TargetRange range = candidates(topology, static_cast<Family>(f), coord);
+                    if (!((families >> f) & 1u) || range.count == 0)
+                    {
+                        continue;
+                    }
+                    const FamilySpec& family = spec.families[f];
+                    const bool horizontal = static_cast<Family>(f) == Family::HorizontalInterconnect;
+                    const std::uint32_t choices = static_cast<std::uint32_t>(range.count - (horizontal ? 1 : 0));
+                    const std::uint32_t inhibitBelow = static_cast<std::uint32_t>(family.inhibitionRatio * 65536.0f);
+                    for (std::int32_t k = 0; k < shares[f]; ++k, ++connIdx)
+                    {
+                        // low 32 bits pick the target, the next 16 inhibition, the top 16 jitter
+                        const std::uint64_t bits = draw(spec.seed, static_cast<Family>(f), n, k);
+                        std::int32_t target = range.first +
+                            static_cast<std::int32_t>((static_cast<std::uint64_t>(static_cast<std::uint32_t>(bits)) * choices) >> 32);
+                        target += (horizontal && target >= n) ? 1 : 0;      // never the source itself
+                        const bool inhibitory = static_cast<std::uint32_t>((bits >> 32) & 0xFFFF) < inhibitBelow;
+                        const std::int32_t jitter = static_cast<std::int32_t>((bits >> 48) % tconst::distance_jitter);
+                        m_connPool[connIdx] = connection::Connection{target, 0, family.distance + jitter,
+                            static_cast<std::int16_t>(inhibitory ? -spec.weight : spec.weight), 0};
+                        *row++ = connIdx;
+                    }
+                }
+            }
+        });
+
+        m_neuronPool.outgoingOffsets.swap(offsets);
+        m_neuronPool.outgoingSignals.swap(flat);
+        currentConnectionSlot = static_cast<std::int32_t>(firstConnection + total - 1);
+        return total;
+    }
+
+    // the five builders aTCN declared, one family each, and all of them in one pass
+
+    template <typename Topology>
+    std::int64_t buildForwardVerticalBranched(const Topology& topology, const BuildSpec& spec = BuildSpec{})
+    {
+        return build(topology, spec, 1u << static_cast<std::int32_t>(Family::ForwardVerticalBranched));
+    }
+
+    template <typename Topology>
+    std::int64_t buildBackwardVerticalBranched(const Topology& topology, const BuildSpec& spec = BuildSpec{})
+    {
+        return build(topology, spec, 1u << static_cast<std::int32_t>(Family::BackwardVerticalBranched));
+    }
+
+    template <typename Topology>
+    std::int64_t buildForwardVerticalInterconnect(const Topology& topology, const BuildSpec& spec = BuildSpec{})
+    {
+        return build(topology, spec, 1u << static_cast<std::int32_t>(Family::ForwardVerticalInterconnect));
+    }
+
+    template <typename Topology>
+    std::int64_t buildBackwardVerticalInterconnect(const Topology& topology, const BuildSpec& spec = BuildSpec{})
+    {
+        return build(topology, spec, 1u << static_cast<std::int32_t>(Family::BackwardVerticalInterconnect));
+    }
+
+    template <typename Topology>
+    std::int64_t buildHorizontalInterconnect(const Topology& topology, const BuildSpec& spec = BuildSpec{})
+    {
+        return build(topology, spec, 1u << static_cast<std::int32_t>(Family::HorizontalInterconnect));
+    }
+
+    template <typename Topology>
+    std::int64_t buildConnectionNetwork(const Topology& topology, const BuildSpec& spec = BuildSpec{})
+    {
+        return build(topology, spec, allFamilies);
+    }
+
+}   // end netbuild namespace
+
+#endif // NETWORKBUILDER_H_INCLUDED
@@ -3,14 +3,18 @@
 #include <iostream>
 #include <cstdint>
 #include <vector>
+#include <utility>
 
 #include "TCNConstants.h"
 #include "Signal.h"
 #include "Connection.h"
+#include "SignalArena.h"
+#include "PoolStorage.h"
+#include "ActiveSet.h"
 
 namespace neuron
 {
-  struct Neuron {
+  struct NeuronPool {
 
     /**
      * @brief Neurons are passive entities that form the nodes between which
@@ -29,7 +33,7 @@ namespace neuron
      * The incomingSignals queue grows and shrinks over time
      * The outgoingSignals is a largely static list of connections
      * constructed when the neuron network is built.
-     * Every individual neuron will have both vector queues.
+     * Every individual neuron will have both queues.
      * There is no need to remember the oldest threshold for a neuron;
      * by definition it is (Now - aggregationWindow) whenever the neuron
      * is processed by the sweep of the TCN.
@@ -43,16 +47,133 @@ namespace neuron
      * into the srb and connpools as the remain resolvable even if vectors move around
      * in the heap.
      * 
+     * Oct 2026 Structure of arrays. The pool used to be a vector of Neuron structs, each holding
+     * two std::vector queues - two separate heap blocks per neuron and 48 bytes of vector headers
+     * dragged through the cache every time the scan looked at nextEvent or refractoryEnd.
+     * The pool is now one struct of parallel arrays indexed by neuron slot number:
+     *    nextEvent[], refractoryEnd[]      contiguous - scanned every tick
+     *    incomingSignals[]                 per neuron queue, only touched for due neurons
+     *    outgoingOffsets[] + outgoingSignals[]
+     *                                      compressed sparse row (CSR) fan-out. The connections for
+     *                                      neuron n are outgoingSignals[outgoingOffsets[n] .. outgoingOffsets[n+1])
+     * The fan-out is static once the network is built. Builders stage connections with addOutgoing()
+     * and compress them with buildOutgoingIndex(); there is no per neuron vector for outgoing at all.
+     * Neurons no longer carry proto entries pointing at srb[0] / connPool[0].
+     * 
+     * Oct 2026 incomingSignals is an arena::SignalArena - every queue is a block in one slab
+     * recycled through size class free lists, so enqueue and purge stop hitting malloc/free.
+     * incomingSignals[n] returns a vector-like SignalQueue view; release() replaces the swap trick.
+     * 
      */
-    
 
+    // Range over one neuron's slice of the CSR fan-out so it can be used in a range-for
+    struct OutgoingRange {
+      const std::int32_t* first;
+      const std::int32_t* last;
+      const std::int32_t* begin() const { return first; }
+      const std::int32_t* end() const { return last; }
+      std::size_t size() const { return static_cast<std::size_t>(last - first); }
+      bool empty() const { return first == last; }
+    };
+
+    std::vector<std::int32_t> nextEvent;                  // set when a signal is enqued.
+    std::vector<std::int32_t> refractoryEnd;              // dynamically set when cascade happens.
+    arena::SignalArena incomingSignals;                   // srb::SignalHandle per signal, one queue per neuron
+    std::vector<std::int32_t> outgoingOffsets;            // CSR row starts, size() + 1 entries
+    std::vector<std::int32_t> outgoingSignals;            // CSR flat list of index into connPool
+
+    // connections staged by the network builders before buildOutgoingIndex()
+    std::vector<std::pair<std::int32_t, std::int32_t>> pendingOutgoing;
+
+    active::ActiveSet activeNeurons;                      // Oct 2026: neurons with anything pending
+    std::int32_t purgeCursor{0};                          // Oct 2026: next active member the purge sweep visits
+
+    std::int32_t size() const { return static_cast<std::int32_t>(nextEvent.size()); }
+
+    void swap(NeuronPool& other)
+    {
+      // exchange whole pools - used to park one TCN's neurons while another runs
+      nextEvent.swap(other.nextEvent);
+      refractoryEnd.swap(other.refractoryEnd);
+      incomingSignals.swap(other.incomingSignals);
+      outgoingOffsets.swap(other.outgoingOffsets);
+      outgoingSignals.swap(other.outgoingSignals);
+      pendingOutgoing.swap(other.pendingOutgoing);
+      activeNeurons.swap(other.activeNeurons);
+      std::swap(purgeCursor, other.purgeCursor);
+    }
+
+    void resize(std::int32_t count, std::int32_t initialNextEvent, std::int32_t initialRefractoryEnd)
+    {
+      // all per neuron arrays grow together; queues start empty and own no heap
+      pools::fill(nextEvent, static_cast<std::size_t>(count), initialNextEvent);
+      pools::fill(refractoryEnd, static_cast<std::size_t>(count), initialRefractoryEnd);
+      incomingSignals.resize(count, tcnconstants::neuron_signal_ratio);
+      outgoingOffsets.assign(count + 1, 0);
+      outgoingSignals.clear();
+      pendingOutgoing.clear();
+      activeNeurons.resize(count);
+      purgeCursor = 0;
+    }
+
+    OutgoingRange outgoing(std::int32_t neuronId) const
+    {
+      const std::int32_t* base = outgoingSignals.data();
+      return OutgoingRange{base + outgoingOffsets[neuronId], base + outgoingOffsets[neuronId + 1]};
+    }
+
+    void addOutgoing(std::int32_t neuronId, std::int32_t connIdx)
+    {
+      // stage only - the CSR is rebuilt by buildOutgoingIndex()
+      pendingOutgoing.emplace_back(neuronId, connIdx);
+    }
 
+    void buildOutgoingIndex()
+    {
+      /**
+       * @brief Merge the staged connections into the CSR fan-out.
+       * 
+       * @details Counting sort by neuron: count, prefix sum, scatter. Existing connections keep
+       * their order and staged ones follow in the order they were added. Linear in
+       * neurons + connections.
+       */
+      if (pendingOutgoing.empty())
+      {
+        return;
+      }
+      const std::int32_t count = size();
+      std::vector<std::int32_t> offsets(count + 1, 0);
+      for (std::int32_t n = 0; n < count; ++n)
+      {
+        offsets[n + 1] = outgoingOffsets[n + 1] - outgoingOffsets[n];
+      }
+      for (const auto& staged : pendingOutgoing)
+      {
+        ++offsets[staged.first + 1];
+      }
+      for (std::int32_t n = 0; n < count; ++n)
+      {
+        offsets[n + 1] += offsets[n];
+      }
 
-    std::vector<int32_t> incomingSignals; // index into srbPool
-    std::vector<int32_t> outgoingSignals; // index into connPool
-    std::int32_t nextEvent;               // set when a signal is enqued.
-    int32_t refractoryEnd;                // dynamically set when cascade happens.
+      std::vector<std::int32_t> flat(offsets[count]);
+      std::vector<std::int32_t> cursor(offsets.begin(), offsets.end() - 1);
+      for (std::int32_t n = 0; n < count; ++n)
+      {
+        for (std::int32_t c = outgoingOffsets[n]; c < outgoingOffsets[n + 1]; ++c)
+        {
+          flat[cursor[n]++] = outgoingSignals[c];
+        }
+      }
+      for (const auto& staged : pendingOutgoing)
+      {
+        flat[cursor[staged.first]++] = staged.second;
+      }
 
+      outgoingOffsets.swap(offsets);
+      outgoingSignals.swap(flat);
+      std::vector<std::pair<std::int32_t, std::int32_t>>().swap(pendingOutgoing);
+    }
   };
 }
 #endif
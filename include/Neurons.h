@@ -2,14 +2,24 @@
 #define NEURONS_H_INCLUDED
 #include <cstddef>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
 #include "SignalRingBuffer.h"
 #include "Neuron.h"
-#include "Tcnconstants.h"
+#include "ActiveSet.h"
+#include "TCNConstants.h"
 #include "Connections.h"
 #include "Signal.h"
+#include "EventWheel.h"
+#include "TickPartitions.h"
+#include "WorkerPool.h"
+#include "AggregationKernel.h"
+#include "TCNTopology.h"
+#include "Trace.h"
 
 // definitions are global
-std::vector<neuron::Neuron> m_neuronPool{}; // allocated by constructor
+neuron::NeuronPool m_neuronPool{};          // structure of arrays, allocated by constructor
 std::int32_t currentNeuronSlot{-1};         // forces allocation to start @0. 
 std::int32_t neuronPoolCapacity{};          // filled in by constructor
 std::int32_t globalNextEvent{0};            // tracks the next event clock tick to process
@@ -21,25 +31,25 @@ extern std::vector<connection::Connection> m_connPool;  // common connection poo
 // external globlals
 std::int32_t masterClock{0};
 
-std::int32_t cascadeAccumulator {0};             // used to accumulate effective neuron signal.
-std::int32_t aggregationDistance{0};             // used to check signal time for aggregation.
-std::int32_t neuronBeingProcessed{0};            // easiest way to track neuronID (aka number)
+// Oct 2026: cascadeAccumulator, aggregationDistance and neuronBeingProcessed are locals of the
+// partition scan now - as globals they would be shared by every worker thread.
 std::int32_t youngestSignal{0};                  // used for purging incoming signals
+std::vector<std::int32_t> dueNeurons{};          // neurons handed out by the event wheel for this tick
+workers::WorkerPool tickWorkers{};               // threads for the parallel tick phases - none by default
+tick::TickPartitions tickPartitions{};           // neuron ranges and their per tick work lists
 
 /** POP
     All neuron references exchanged with outside classes are done using
     the neuron slot number - aka it's vector element index number. This avoids any issues if neurons or the queue
     of neurons and signals are re-provisioned on the heap.
-    Signals are pushed onto the neuron signalQueue in the order they arise, which
-    is not related to the future clock time when they will become active.
-    Thus, all tests for signal aggregation and next lowest event clock must scan
-    the entire neuron signal queue. The was determined to be a much better performer
-    than sorting the signal queue vector by future clock value every time a new
-    signal is added to the neuron's signal queue as sorting a vector involves multiple passes.
-    Neuron keeps track of the oldest signal it has in queue as that's when it next needs
-    to scan the incoming queue.
-    Signals stay on the queue past their processing time until the aggregation decay
-    window has elapsed when they become eligible for purging.
+    Signals are kept on the neuron's incomingSignals queue in actionTime order. enqueueSignal
+    inserts each handle at its place (insert_sorted) - nearly always the back, as signals mostly
+    arise in the order they come due - so the aggregation window is a slice of the queue found by
+    a binary search, and the neuron's nextEvent is the first signal after the masterClock and
+    after any refractory period. A handle whose srb slot has been reused is stale and carries no
+    time, wherever it sits in the queue; the searches step over it.
+    Signals stay on the queue past their processing time until they fall out of the aggregation
+    window, when they become eligible for purging.
     Neurons are just dumb passive structs. Any activity that results from their condition is 
     handled by the processing routines in the Neurons class as it scans the neuron pool.
     The Neuron struct cannot afford the luxury of having any active components because of the memory
@@ -51,8 +61,8 @@ std::int32_t youngestSignal{0};                  // used for purging incoming si
     LTP signal augmentation.
 
     CRUCIAL EFFICIENCY INSIGHT: Neurons do not need to react to signals being enqueued as they will 
-    always be an event in the future. We scan all neurons and their signal queues at the current 
-    clock time, looking for aggregations that cause a cascade. Cascades cause a signal to be sent 
+    always be an event in the future. At each clock time we look at the signal queues of the neurons
+    due then, looking for aggregations that cause a cascade. Cascades cause a signal to be sent 
     to one or more connections for future delivery or ignoring if target is refractory.
     For efficiency of processing it is essential that we do not determine if a neuron has to react the 
     second it receives a new signal. Even if the signal event were the next clock tick the incoming signal
@@ -63,6 +73,8 @@ std::int32_t youngestSignal{0};                  // used for purging incoming si
     time beyond the current clock tick.
     And the consequence of this ability to scan in parallel means that the network can be distributed across multiple
     cooperating computers, each with their own portion of the network, all working using the same clock time.
+    Oct 2026: the tick engine now does exactly this - SixPack aligned neuron partitions scanned by a pool of
+    worker threads, with the cascades' signals merged and enqueued at the tick barrier (see TickPartitions.h).
 
     EVENTs & CLOCK TIMES: The masterClock starts a zero. Older signals have smaller clock times then younger signals. When
     signals are enqueued on to a neuron they have an actionTime which represents the time when a signal is expected
@@ -75,51 +87,22 @@ std::int32_t youngestSignal{0};                  // used for purging incoming si
     NEURON & GLOBAL NEXT EVENT: This is among the trickiest of algorithms to get right, be efficient, and avoid
     unnecessary scans of the neuron pool.
     All neurons start with their nextEvent set to INT32_MAX, which means they will not process before the end of time.
-    When a signal is generated by a connection the signal actionTime is the  masterClock + temporalDistanceToTarget
-    as all Connection times are relative from the originator to the target. Upon signal generation the algorithm
-    is simple; set the neuron nextEvent to the lower of it's current value or the signal actionTime as computed.
-    The signal actionTime will always be greater than the masterClock and may or may not be before some prior
-    signal enqueued on the target neuron. Capturing the lowest neuron nextEvent is always done at signal generation
-    time and relies on the proto neurons starting out with their nextEvent set to MAX. 
-    Now signals are only created during the scan of the neurons looking for signals that are ready to be examined.
-    This means that the neuron scan alread set the globalNextEvnt to MAX ready to catch the next lowest neuron
-    nextEvent so signal creation can always compare and update the globlNextEvent as well as the target neuron
-    nextEvent even if the target neuron is prior to the neuron currently being processed. Changing the globlNextEvent
-    to a lower clock value will never take it backwards in time and will not affect the processing of the current
-    neuron pool scan.
-    When TCN starts the masterClock is set to zero (0) and a scan of all neurons is initiated. The globalNextEvent
-    is set to MAX at the start of neuron pool scan. At each neuron the test is made: is the neuron nextEvent the 
-    same as the masterClock? This must be the neuron nextEvent clock that is currently being processed. 
-    If not then is the neuron nextEvent less than the current globalNextEvent? If so then capture the lower neuron
-    nextEvent value. 
-    If the current neuron nextEvent is used to set the globalNextEvent then this neuron creates signals that are
-    even earlier it doesn't matter as the signal creation from the current neuron uses the connection signal 
-    generation which checks for any lower future signal actionTime values and updates the neuron nextEvent and the
-    globalNextEvent values, neither of which affect the current neuron being processed.
-    Their is an edge case when the neuron goes refractory. As this lasts longer than the agreggation window for
-    enqueued signal that neuron should purge its signal queue plus reset its nextEvent to max so the next signal
-    generated to that neuron will once again set the neuron nextEvent time. however this could lose enqueue events beyond 
-    the refractory period if there is not anothe signal delivered to this neuron.
-
-    WHY WE DON'T SORT QUEUES: To do a sort always requires at least one, if not more passes through the queue 
-    elements to complete the sort. If we do sort every time we add something to a queue of signals we would 
-    scan the whole queue multiple times, once for every time we added a signal.
-    Therefore we just scan the queue of signals once when there are any entries in the signal queue and we are
-    scanning the all the neurons for work and we record the next event time for the oldest signal (smallest
-    clock time) for any of the signals on the neurons signal queue. 
-    If nothing else changes this will become the next clock event time when we need to scan this neuron for work.
-
-    The worst thing we could do is update the next event clock time and sort the signal queue every time a signal
-    was added to a neuron. The whole scheme depends on the fact that new signals can never be enqued for any clock
-    time prior to the one we are currently processing, even for neurons that we have previously passed over.
-
-    It is conceivable that a signal could be enqueued to a prior neuron that would lower that neuron's event clock
-    and the overall global event clock. The solution to that is whenever a signal is generated and enqueued, 
-    we update the global event clock to reflect the lowest signal future clock time created.
-
-    As an alternative we could never bother to scan the neuron incoming signal queue and just rely on every signal
-    updating the global clock event and not bother to scan each neuron for a separate next event and just look
-    through the neuron signal queues every time we scan all the neurons.
+    When a signal is generated by a connection the signal actionTime is the masterClock + temporalDistanceToTarget
+    as all Connection times are relative from the originator to the target. Distances are at least one tick, so the
+    actionTime is always later than the masterClock. Enqueueing the signal sets the target's nextEvent to the lower
+    of its current value and the actionTime and, when that lowered it, schedules the target on the event wheel at
+    that time. The wheel hands back exactly the neurons due at each tick, so a tick visits those and no others, and
+    the globalNextEvent is simply the wheel's earliest occupied tick.
+    After a neuron has been processed its nextEvent is worked out again from its queue: the first signal after the
+    masterClock, or after the refractory end if the neuron has just cascaded. Signals enqueued during the refractory
+    period for a time beyond it are therefore kept and come due - nothing is lost by going refractory.
+
+    WHY QUEUES ARE SORTED: Signals nearly always arrive in actionTime order - a cascade's signals are later than
+    anything already due - so keeping a queue sorted is an append almost every time and a short move otherwise.
+    In return no queue is ever scanned end to end: the aggregation window and the next event are binary searches,
+    and the purge drops a prefix in one step.
+    The whole scheme depends on the fact that new signals can never be enqueued for any clock time at or before the
+    one we are currently processing, even for neurons that we have previously passed over.
 
 *   July 2025: Cannot create vector of refs - have to use pointers to avoid making
 *   copies of neurons into the vector.
@@ -132,8 +115,7 @@ std::int32_t youngestSignal{0};                  // used for purging incoming si
 
     July 2025: When we are processing signals they are handled at the current masterClock time that was set from
     globalNextEvent - which was gleaned from all the signals. 
-
-
+*/
 
 /**
  * @brief Holder of neuron pool
@@ -146,9 +128,9 @@ std::int32_t youngestSignal{0};                  // used for purging incoming si
  * of where we are in the pool and dispenses ++currentNeuronIndex when asked to allocate a neuron.
  * This allocation of a vector element index should be vector storage location invariant.
  * 
- * Upon a scan request, goes through every neuron in the network, skipping those that are refractory,
- * those that are proto empty copies from neuron pool building at start-up and those that have a next 
- * signal processing time that is in the past.
+ * Upon a scan request, goes through every neuron the event wheel has due at the masterClock, skipping
+ * those that are refractory, those that are proto empty copies from neuron pool building at start-up and
+ * stale wheel entries whose nextEvent has since moved.
  * 
  * @param   size of neuron pool
  * 
@@ -168,6 +150,9 @@ namespace neurons
         conns::Connections connObject;
         srb::SignalRingBuffer signalObject;
         std::int32_t signalRequestor {};         // process requesting node for nextEvent
+        std::vector<std::int32_t> learningBatch; // a tick's contributors from every partition, sorted
+        std::vector<std::int32_t> joinBatch;     // Oct 2026: neurons joining the active set this tick, sorted
+        active::ActivityStats tickActivity;      // Oct 2026: the last tick's activity
         /**
          * The Neurons class is responsible for creating the pool of neurons which
          * size is computed in the TCNConstants.h header.
@@ -187,124 +172,34 @@ namespace neurons
             {
                 #ifdef TESTING_MODE
                 // just reserve 75 neurons for initial testing
-                    m_neuronPool.reserve(75);
-                #else
-                    m_neuronPool.reserve(poolSize);
+                    poolSize = 75;
                 #endif
 
-                neuronPoolCapacity = m_neuronPool.capacity();
-
-                // init m_neuronPool with empty neurons to allocate heap
-                // regardless of the pool size, even if testing, we need 
-                // to push some values to trigger heap allocation.
-
-                // create an empty neuron - do NOT use a struct constructor 
-                // otherwise every neuron will bear the overhead.
-
-                // first create minimal signal queue and connection queue vectors
-                // use impossible values that will never be processed
-            
-                std::cout << "\n>>>>>>>>>>>>>>NEURONS POOL SETUP\n\n";
-
-                // create  class objects to support printing
-                conns::Connections connObj = conns::Connections();
-                srb::SignalRingBuffer srbObj = srb::SignalRingBuffer();
-
-
-                // std::vector<signal::Signal*> incomingSignals;
-                // incomingSignals.reserve(1);
-                
-                // incoming.push_back(&emptySignal);    // force vector allocation with a ptr
-
-                // std::vector<connection::Connection*> outgoingSignals;
-                // outgoingSignals.reserve(1);
+                TCN_TRACE(INFO, "\n>>>>>>>>>>>>>>NEURONS POOL SETUP\n\n");
 
-                std::vector<std::int32_t> incomingSignals;
-                std::vector<std::int32_t> outgoingSignals;
-
-                incomingSignals.reserve(1);
-                outgoingSignals.reserve(1);
-
-                incomingSignals.push_back(0);   // point to proto signal
-                outgoingSignals.push_back(0);   // point to proto connection
-
-                // std::cout << "\nEmpty signal vectors created\n";
-
-                // Both signal vectors are now initialized to 0, pointing to the proto element in the pool
-
-                // std::cout << "Empty entries for neuron allocation:\n\n";
-
-                // See what's been pushed into signal vectors
-                std::cout << "\nWhat was pushed onto proto vectors?\n";
-                srbObj.printSignalFromIndex(incomingSignals[0]);
-                connObj.printConnectionFromIndex(outgoingSignals[0]);
-
-
-                // std::cout << "\nincoming[0] actionTime:= " << std::to_string(incomingSignals[0]->actionTime);
-                // std::cout << "\noutgoing[0] temporalDistance:= " << std::to_string(outgoingSignals[0]->temporalDistanceToTarget) << std::endl;
+                // Oct 2026: The pool is a structure of arrays. Every neuron starts with
+                // impossible values that will never be processed, an empty incoming queue that owns
+                // no heap, and an empty slice of the CSR fan-out. There are no proto entries
+                // pointing at srb[0] or connPool[0] any more.
 
                 std::int32_t refractoryEnd = INT32_MAX;      // These neurons should never process
                 std::int32_t nextEvent = INT32_MAX;          // Ensure never yet seen signal clock
                                                         // always greater than any signal to be created or processed.
 
-                // This shouldl populate the struct with the provided variables.
-                std::cout << "\nChange how empty neuron is initialized. \n";
-
-                // Much simpler neuron with signal vectors of int32_t's not pointers
-                // which point to the appropriate slot in the srb and connpools.
-                // No more vector pointer volatility
-                neuron::Neuron emptyNeuron{};
-                // neuron::Neuron* emptyNeuronPointer = {&emptyNeuron};
-                emptyNeuron.incomingSignals = incomingSignals;
-                emptyNeuron.outgoingSignals = outgoingSignals;
-                emptyNeuron.nextEvent = nextEvent;
-                emptyNeuron.refractoryEnd = refractoryEnd;
-
-                // What's in the empty neuron?
-                // std::cout << "\nPrint empty neuron\n";
-
-                printNeuronFromRef(emptyNeuron);
-                // std::cout << std::endl;
-                // std::cout << "\nincoming[0]:= " << std::to_string(incomingSignals[0]->actionTime);
-                // std::cout << "\noutgoing[0]:= " << std::to_string(outgoingSignals[0]->temporalDistanceToTarget) << std::endl;
+                m_neuronPool.resize(poolSize, nextEvent, refractoryEnd);
+                neuronPoolCapacity = m_neuronPool.size();
+                setTickThreads(tickWorkers.size());         // keep the engine, re-partition the new pool
 
-                // std::cout << "\nWhat's in the empty neuron signals?\n";
-
-                // std::cout << "\nFirst empty incoming signal\n";
-                // std::cout << "\nFirst empty signal contents:= " << std::to_string(emptyNeuron.incomingSignals[0]);
-
-                // srbObj.printSignalFromIndex(emptyNeuron.incomingSignals[0]);
-
-                // std::cout << "\nFirst outgoing signal\n";
-                // connObj.printConnectionFromIndex(emptyNeuron.outgoingSignals[0]);
-                
-                for (int i = 0; i < m_neuronPool.capacity(); ++i) {
-                    m_neuronPool.push_back(emptyNeuron);
-                }
-
-                // std::cout << "\nIs empty neuron[0] still good in first neuron?\n";
-                // signalObject.printSignalFromIndex(m_neuronPool[0].incomingSignals[0]);
-                // std::cout << std::endl;
-                // connObject.printConnectionFromIndex(m_neuronPool[0].outgoingSignals[0]);
-                // std::cout << std::endl;
-
-                // std::cout << "\nFirst empty neuron signals after building the pool\n";
-                
-                // std::cout << "\nDon't use ptrs to first neuron in pool\n";
-
-                // std::cout << "\nEmpty neuron[0] signals?\n";
-                // std::cout << "\nFirst incoming signal\n";
-                // std::cout << "\nFirst incomingSignal index:= " << m_neuronPool[0].incomingSignals[0];
-                // srbObj.printSignalFromIndex(m_neuronPool[0].incomingSignals[0]);
-
-                // std::cout << "\nFirst outgoing signal\n";
-                // std::cout << "\nFirst outgoingSginal index: } " << m_neuronPool[0].outgoingSignals[0];
-                // connObj.printConnectionFromIndex(m_neuronPool[0].outgoingSignals[0]);
-                // std::cout << "\nCreated " << std::to_string(poolSize) << " empty neurons.\n" << '\n';
+                TCN_TRACE(INFO, "\nCreated " << std::to_string(neuronPoolCapacity) << " empty neurons.\n");
+                TCN_TRACE(INFO, "\n<<<<<<<<<<<<<END NEURON POOL SETUP\n\n");
+            }
 
-                std::cout << "\n<<<<<<<<<<<<<END NEURON POOL SETUP\n\n";
-                
- 
+            template <typename Topology>
+            explicit Neurons(const Topology& topology) : Neurons(topology.neuronCount)
+            {
+                // Oct 2026: a pool sized by a topology::TCNTopology (constant) or DynamicTopology, with
+                // the tick partitions aligned to its SixPacks
+                setTickThreads(tickWorkers.size(), 0, topology.sixPackSize);
             }
 
             // Default constructor
@@ -319,33 +214,31 @@ namespace neurons
             {   
                 std::cout << "\nNeuron Index:= " << std::to_string(nidx);
                 std::cout << "\nincomingSignals size:= " << 
-                    std::to_string(m_neuronPool[nidx].incomingSignals.size());
+                    std::to_string(m_neuronPool.incomingSignals[nidx].size());
                 std::cout << "\noutgoingSignals size:= " <<
-                    std::to_string(m_neuronPool[nidx].outgoingSignals.size());
+                    std::to_string(m_neuronPool.outgoing(nidx).size());
                 std::cout << "\nnextEvent:= " <<
-                    std::to_string(m_neuronPool[nidx].nextEvent);
-                std::cout << "\nrefractoryEnd:= " << std::to_string(m_neuronPool[nidx].refractoryEnd) << '\n';
-            }
-            void printNeuronFromRef(neuron::Neuron& neuronRef)
-            {
-                std::cout << "\nNeuron: incomingSignals:= " 
-                        << std::to_string(neuronRef.incomingSignals.size())
-                        << std::endl;
-                std::cout << "outgoingSignals:= " << std::to_string(neuronRef.outgoingSignals.size())
-                            << std::endl;
-                std::cout << "nextEvent := " << std::to_string(neuronRef.nextEvent)
-                            << std::endl;            
-                std::cout << "refractoryEnd:= " << std::to_string(neuronRef.refractoryEnd)
-                            << std::endl;
+                    std::to_string(m_neuronPool.nextEvent[nidx]);
+                std::cout << "\nrefractoryEnd:= " << std::to_string(m_neuronPool.refractoryEnd[nidx]) << '\n';
             }
 
-            void printNeuronFromPointer(neuron::Neuron* neuronPtr)
+            void setTickThreads(std::int32_t threads, std::int32_t partitions = 0,
+                                std::int32_t alignment = tconst::sixpack_size)
             {
-                std::cout << "\nNeuron: incomingSignals:= " <<
-                        std::to_string(neuronPtr->incomingSignals.size()) <<
-                        "\noutgoingSignals:= " << std::to_string(neuronPtr->outgoingSignals.size()) <<
-                        "\nrefractoryEnd:= " << std::to_string(neuronPtr->refractoryEnd) <<
-                    std::endl;
+                /**
+                 * @brief Choose the tick engine: threads in total (0 = one per hardware thread) and the
+                 * number of neuron partitions (0 = one per thread).
+                 * 
+                 * @details Oct 2026: setTickThreads(1) is the serial engine. Partitions are aligned to
+                 * SixPack boundaries, and the signal arena is split into one shard per partition so each
+                 * worker only ever touches its own slab. More partitions than threads gives the workers
+                 * something to balance with; the results are the same for any choice.
+                 * alignment is the SixPack size of a topology whose SixPacks are not the default shape.
+                 */
+                tickWorkers.resize(threads);
+                partitions = (partitions > 0) ? partitions : tickWorkers.size();
+                tickPartitions.configure(m_neuronPool.size(), partitions, alignment);
+                m_neuronPool.incomingSignals.partition(tickPartitions.firstNeurons());
             }
 
             void scanNeuronsForSignals()
@@ -355,17 +248,72 @@ namespace neurons
                 // Have to keep track of the neuron slot being processed as there is
                 // no way for the range to let us know where we are
 
-                std::int32_t  neuronBeingProcessed = -1;
+                // Oct 2026: The scan no longer walks every neuron in the pool. The event wheel hands
+                // back only the neurons that have a signal due at the current masterClock, so a tick
+                // costs O(due neurons) rather than O(neuron_count).
+
+                // Oct 2026: The tick runs in phases so the neuron partitions can be processed in parallel
+                // (see TickPartitions.h). Due neurons are sorted, and the wheel's duplicates dropped, so
+                // every engine visits them in neuron id order and produces identical results:
+                //    processPartition   parallel - aggregate, cascade, purge; cascades fill the outbox
+                //    reserveSignalSlots serial   - one block of srb slots per partition, in neuron order
+                //    emitPartition      parallel - fill the block, append to the target partition's inbox
+                //    deliverPartition   parallel - enqueue each partition's inbox on its own neurons
+                //    finishTick         serial   - strengthen, reschedule, globalNextEvent, purge sweep
+                // A cascade's signals are therefore enqueued at the end of the tick rather than straight
+                // away, which changes nothing as no signal is ever due at the tick that raised it.
 
                 // masterClock = globalNextEvent;        // Always the next clock tick when we are asked to scan neurons.
                 globalNextEvent = INT32_MAX;             // This forces capture of some lower clock event
+                srb::followClock(masterClock);           // Oct 2026: keep signal times within epochSpan of the clock
 
+                dueNeurons.clear();                      // keeps its capacity from tick to tick
+                eventWheel.collectDue(masterClock, dueNeurons);
+                std::sort(dueNeurons.begin(), dueNeurons.end());
+                dueNeurons.erase(std::unique(dueNeurons.begin(), dueNeurons.end()), dueNeurons.end());
+                tickPartitions.splitDue(dueNeurons);
 
-                std::cout << "\n\n...>>>>>>>>STARTING NEURON SCAN...<<<<<<<<\n";
+                TCN_TRACE(INFO, "\n\n...>>>>>>>>STARTING NEURON SCAN...<<<<<<<<\n");
 
-                for (neuron::Neuron nRef : m_neuronPool)
+                std::int32_t partitions = tickPartitions.count();
+                tickWorkers.run(partitions, [this](std::int32_t p) { processPartition(tickPartitions[p]); });
+                if (reserveSignalSlots())
+                {
+                    tickWorkers.run(partitions, [this](std::int32_t p) { emitPartition(tickPartitions[p], true); });
+                    std::int64_t liveOverwrites{0};
+                    for (std::int32_t p = 0; p < partitions; ++p)
+                    {
+                        liveOverwrites += tickPartitions[p].slots.liveOverwrites;
+                    }
+                    signalObject.commitSlots(liveOverwrites);
+                }
+                else
+                {
+                    // one slot at a time through allocateSignalSlot, still in neuron order
+                    for (std::int32_t p = 0; p < partitions; ++p)
+                    {
+                        emitPartition(tickPartitions[p], false);
+                    }
+                }
+                tickWorkers.run(partitions, [this](std::int32_t p) { deliverPartition(tickPartitions[p]); });
+                finishTick();
+                
+                TCN_TRACE(INFO, "\nDue neurons processed:= " << std::to_string(dueNeurons.size()) << std::endl);
+                TCN_TRACE(INFO, "End of neuron scan \n");
+            }
+
+            void processPartition(tick::Partition& partition)
+            {
+                /**
+                 * @brief Phase 1 of a tick: aggregate and cascade the partition's due neurons.
+                 * 
+                 * @details Only reads the srb and the connections, and only writes the partition's own
+                 * neurons, its own arena shard, the cascading neurons' own connections and the partition
+                 * work lists - which is why partitions can run side by side.
+                 * Debug traces from several workers interleave; trace with one thread.
+                 */
+                for (std::int32_t neuronBeingProcessed : partition.due)
                 {
-                    //  nRef will be set to a ref to every neuron in the pool
                     //  Conditions to process a neuron when ooking for work:
                     //
                     //  Not refractory
@@ -386,19 +334,23 @@ namespace neurons
                     //  the neuron's nextEvent must be equal to the current masterClock - otherwise it
                     //  will wait for another pass to be processed.
 
-                    //  track neuronId which is zero based and is vector slot number in m_neuronPool
+                    // refs into the pool arrays so all updates stick
+                    std::int32_t& nextEvent = m_neuronPool.nextEvent[neuronBeingProcessed];
+                    std::int32_t& refractoryEnd = m_neuronPool.refractoryEnd[neuronBeingProcessed];
+                    arena::SignalQueue incomingSignals = m_neuronPool.incomingSignals[neuronBeingProcessed];
 
-                    ++neuronBeingProcessed;     // Only way to count slots during a forEach 
+                    // The wheel can hold stale entries when a neuron's nextEvent was lowered after it
+                    // was first scheduled.
+                    // Only the entry that matches the neuron nextEvent is worth processing.
+                    if (nextEvent != masterClock)
+                    {
+                        continue;
+                    }
 
                     // Check if the incomingSignals queue should be purged - which is a potentially 
                     // a very expensive operation and must be optimized.
 
-                    
-                    
-                    // nRef.nextEvent = INT32_MAX;
-
-
-                    if ( masterClock > nRef.refractoryEnd  && nRef.nextEvent == masterClock)
+                    if ( masterClock > refractoryEnd  && nextEvent == masterClock)
                     // Only process neurons signal queue when they have exited refractory
                     // There is never anything to be done for a refractory neuron as all incoming
                     // signals were purged when it went refracory and no new signals can enqueue 
@@ -409,23 +361,24 @@ namespace neurons
                     // Neurons only merit attention when there is a signal due to process at the current
                     // masterClock time.
                     {                    
-                        std::cout << "\nProcessing non-refractory neuron:= " << 
-                            std::to_string(neuronBeingProcessed) << "\n";
+                        TCN_TRACE(DEBUG, "\nProcessing non-refractory neuron:= " << 
+                            std::to_string(neuronBeingProcessed) << "\n");
 
-                        std::cout << "\nmasterClock:= " << std::to_string(masterClock);
-                        printNeuronFromRef(nRef);
+                        TCN_TRACE(DEBUG, "\nmasterClock:= " << std::to_string(masterClock));
+                        TCN_TRACE_DO(DEBUG, printNeuronFromIndex(neuronBeingProcessed));
  
-                        std::cout << "\nincomingSignals size:= " << std::to_string(nRef.incomingSignals.size());
-                        std::cout << "\nactionTime:= " << std::to_string(m_srb[nRef.incomingSignals[0]].actionTime);
+                        TCN_TRACE(DEBUG, "\nincomingSignals size:= " << std::to_string(incomingSignals.size()));
+                        TCN_TRACE(DEBUG, "\nactionTime:= " << (incomingSignals.empty() ? std::string("none") :
+                                                std::to_string(srb::handleActionTime(incomingSignals[0]))));
 
                         //  The second test finds any neuron that has never received a signal and is still the way
                         //  it was initialized.
-                        if ( ((nRef.incomingSignals.empty()) ||
-                                (   nRef.incomingSignals.size() == 1 &&
-                                    m_srb[nRef.incomingSignals[0]].actionTime == INT32_MAX))  )
+                        if ( ((incomingSignals.empty()) ||
+                                (   incomingSignals.size() == 1 &&
+                                    srb::handleActionTime(incomingSignals[0]) == INT32_MAX))  )
                         {
                             // Skip proto signals or empty incoming queues that got purged
-                            std::cout << "\nSkip proto signal\n";   // skip the proto signal
+                            TCN_TRACE(DEBUG, "\nSkip proto signal\n");   // skip the proto signal
                             // At this point, if it's worth doing, we could reset the signal queue 
                             // to empty using the swap trick.
                             ;
@@ -439,62 +392,61 @@ namespace neurons
                             // globalNextEvent = (globalNextEvent <= m_neuronPool[neuronBeingProcessed].nextEvent) ?
                             //     globalNextEvent : m_neuronPool[neuronBeingProcessed].nextEvent;
 
-                            std::cout << "\nStart cascade accumulation....\n";
-                            cascadeAccumulator = 0;
-                            for (std::int32_t sRef : nRef.incomingSignals)
+                            TCN_TRACE(DEBUG, "\nStart cascade accumulation....\n");
+                            std::int32_t cascadeAccumulator{0};     // effective neuron signal
+                            // Oct 2026: the queue is in actionTime order so the aggregation window is the
+                            // contiguous slice [masterClock - window + 1, masterClock] - two binary searches
+                            // instead of a walk over every pending signal.
+                            const std::int32_t* windowEnd = firstSignalAtOrAfter(incomingSignals, masterClock + 1);
+                            const std::int32_t* windowBegin = aggregationWindowStart(incomingSignals, windowEnd, refractoryEnd);
+                            if constexpr (trace::enabled<DEBUG>)
                             {
-                                // Just use the simple signal size for now - without  stp/ltp
-                                // We aggregate existing prior signals for aggretation window width
-                                // Have to scan the complete signal queue as they are not sorted by time of action
-
-                                std::cout << "\nSignal action time: " << std::to_string(m_srb[sRef].actionTime);
-
-                                // At this point, as we step through all of the incoming signals, we should
-                                // be able to capture the next oldest signal beyond the current masterClock
-                                //
-                                // Only aggregate signals that are <= current master_clock and within the
-                                // aggregation window. 
-                                // Make sure we skip proto signals with INT_MIN action times.
-
-                                std::cout << "\nMaster clock & actionTime:= " << std::to_string(masterClock) <<
-                                        " : " << std::to_string(m_srb[sRef].actionTime);
-
-                                // Processing note: all those that are at the same temporal distance inside
-                                // the aggregation window will all receive the same degradation.
-                                // Two signals @ -2 are as powerful as four signal @ -4
-                                // The test against INT32_MIN is to skip over proto signals
-                                // Ownership test is to guard against SRB wrap.
-
-                                if (m_srb[sRef].actionTime > INT32_MIN &&           // skip proto signals
-                                    m_srb[sRef].actionTime <= masterClock &&        // skip future signals
-                                    m_srb[sRef].actionTime > masterClock - 5 &&     // skip older than aggregation window
-                                    m_srb[sRef].owner == neuronBeingProcessed)      // skip signals we don't own
+                                for (const std::int32_t* sPtr = windowBegin; sPtr != windowEnd; ++sPtr)
                                 {
-                                    aggregationDistance = masterClock - m_srb[sRef].actionTime;
-                                    std::cout << "\nAggregation distance:= " << std::to_string(aggregationDistance);
-
-                                    switch (aggregationDistance)
+                                    // Oct 2026: queues hold generation tagged handles - a stale handle means the
+                                    // slot has been reused since it was enqueued, so the signal is not ours.
+                                    if (!srb::isCurrent(*sPtr))
+                                    {
+                                        continue;
+                                    }
+                                    const std::int32_t actionTime = srb::actionTime(m_srb[srb::handleSlot(*sPtr)]);
+                                    TCN_TRACE(DEBUG, "\nSignal action time: " << std::to_string(actionTime));
+                                    TCN_TRACE(DEBUG, "\nMaster clock & actionTime:= " << std::to_string(masterClock) <<
+                                            " : " << std::to_string(actionTime));
+                                    if (actionTime <= masterClock &&
+                                        actionTime > masterClock - tconst::aggregation_window_ticks)
                                     {
-                                        case -5:    cascadeAccumulator += m_srb[sRef].amplitude / 32;
-                                            break;
-                                        case -4:    cascadeAccumulator += m_srb[sRef].amplitude / 16;
-                                            break;
-                                        case -3:    cascadeAccumulator += m_srb[sRef].amplitude / 8;
-                                            break;
-                                        case -2:    cascadeAccumulator += m_srb[sRef].amplitude / 4;
-                                            break;
-                                        case -1:    cascadeAccumulator += m_srb[sRef].amplitude / 2;
-                                            break;
-                                        case 0:     cascadeAccumulator += m_srb[sRef].amplitude;
-                                            break;                  
+                                        TCN_TRACE(DEBUG, "\nAggregation distance:= " << std::to_string(masterClock - actionTime));
                                     }
                                 }
                             }
+
+                            // Processing note: all those that are at the same temporal distance inside
+                            // the aggregation window will all receive the same degradation.
+                            // Two signals @ -2 are as powerful as four signal @ -4
+                            // Oct 2026: the signal amplitudes are aggregated by aggregation::accumulate - a
+                            // branch free shift by distance. The old switch had case labels -1 .. -5 for a
+                            // distance that is never negative, so only signals due at the masterClock counted.
+                            // Stale handles (the generation check replaces the ownership test) add nothing.
+                            // Oct 2026: the pass also records the sourceConnId of every signal it counts in the
+                            // partition's scratch - kept only if the neuron cascades.
+                            std::size_t windowSize = static_cast<std::size_t>(windowEnd - windowBegin);
+                            if (partition.scratch.size() < windowSize)
+                            {
+                                partition.scratch.resize(windowSize);
+                            }
+                            std::int32_t contributorCount{0};
+                            cascadeAccumulator = aggregation::accumulate(windowBegin, windowEnd, m_srb.data(), masterClock,
+                                                                         partition.scratch.data(), contributorCount);
+
                             if (cascadeAccumulator >= tconst::cascadeThreshold)
                             {
                                 // neuron cascades and broadcasts it's own signal
-                                std::cout << "\nNeuron cascades with accumulator:= " << std::to_string(cascadeAccumulator);
-                                signalRequestor = connObject.generateOutGoingSignals(neuronBeingProcessed);
+                                ++partition.cascades;
+                                TCN_TRACE(INFO, "\nNeuron cascades with accumulator:= " << std::to_string(cascadeAccumulator));
+                                // Oct 2026: signals go to the partition outbox and are emitted at the barrier.
+                                TCN_TRACE(DEBUG, "\nGenerate signals called with neuronId:= " << std::to_string(neuronBeingProcessed));
+                                connObject.collectOutgoingSignals(neuronBeingProcessed, partition.outbox);
 
                                 // July 2025 New STP/LTP group strengthening requirement:
                                 // For all the signals that could have contributed to this cascade,
@@ -503,19 +455,13 @@ namespace neurons
                                 // Now that neuron has cascaded and generated its signals it should be put
                                 // into refractory and have all of its signals purged.
 
-                                // Have to determine, again, which incomingSignals contributed to the cascade
-                                // to get their sourceConnId.
-
-                                for (std::int32_t  sIdx : nRef.incomingSignals)
-                                {
-                                   if (m_srb[sIdx].actionTime <= masterClock &&
-                                      m_srb[sIdx].actionTime > masterClock - 5)
-                                     {   // strengthen the connections that caused the cascade
-                                         connObject.strengthen(m_srb[sIdx].sourceConnId);
-                                     }
-                                }
+                                // Oct 2026: the aggregation pass has already found the contributors - no
+                                // second walk of the window. They are strengthened in finishTick - connections
+                                // belong to other partitions - so new weights apply from the next tick on.
+                                partition.contributors.insert(partition.contributors.end(), partition.scratch.data(),
+                                                              partition.scratch.data() + contributorCount);
                                      
-                                nRef.refractoryEnd = tconst::refractoryWidth + masterClock;
+                                refractoryEnd = tconst::refractoryWidth + masterClock;
 
                                 // This is the right place to examine neurons for purging signals
                                 // After the neuron has processed, any signals up thru the aggregation window
@@ -523,149 +469,404 @@ namespace neurons
                                 // There may still be future signals enqueued for later processing after refractory
                                 // and these should not be purged.
 
-                                // Purge old signals
-                                if (nRef.incomingSignals.size() > tconst::purgeThreshold)
+                                // Oct 2026: only a queue longer than purgeThreshold is purged here - the rest is
+                                // left to the purge sweep at the end of the tick (sweepStaleSignals).
+                                if (incomingSignals.size() > tconst::purgeThreshold)
                                 {
-                                    // Only make the call if there enough signals to bother with
-                                    purgeOldSignals(nRef);
+                                    purgeOldSignals(neuronBeingProcessed);
                                 }
                             }
                         }
                     }
-                    else  if (masterClock <= nRef.refractoryEnd)
-                    {           // this is the process for refractory neurons
-                        purgeOldSignals(nRef);
-                    }  
-                    else if (nRef.nextEvent == INT32_MAX)
-                    {   
-                        purgeOldSignals(nRef);  // check for old signals to purge
-                    }
+                    // Oct 2026: refractory neurons are no longer purged when they come due. The signals
+                    // due while refractory are skipped - never aggregated, never a nextEvent - and the
+                    // purge sweep reclaims them, so a refractory neuron is not even visited for them.
 
                     // Test to purge neuron signal after proceesing before we move on
 
-                    // pseudo purgeOldSignals(neuronBeingProcessed);
+                    // This is the end of processing for each neuron.
+                    // Now is the time to scan incomingSignals and update the neuron nextEvent.
+                    // The current tick has been consumed so the neuron next event is the oldest
+                    // signal beyond the masterClock - and that is when the wheel must revisit it.
+
+                    // Oct 2026: signals at or before the masterClock may still be queued for later
+                    // aggregation, so the next event is the first queued signal after the masterClock -
+                    // and after the refractory end.
+                    // (refractoryEnd INT32_MAX is a neuron that never processes - nothing is its next event)
+                    const std::int32_t nextFrom = (refractoryEnd <= masterClock) ? masterClock + 1
+                                                : (refractoryEnd < INT32_MAX) ? refractoryEnd + 1 : INT32_MAX;
+                    const std::int32_t* nextSignal = firstSignalAtOrAfter(incomingSignals, nextFrom);
+                    nextEvent = (nextSignal == incomingSignals.end()) ? INT32_MAX : srb::handleActionTime(*nextSignal);
+                    if (nextEvent != INT32_MAX)
+                    {
+                        partition.reschedule.push_back(wheel::WheelEntry{neuronBeingProcessed, nextEvent});
+                    }
+                }   // end of due neuron loop
+            }
 
-                    // This is another candidate to merge inline and avoid an expensive
-                    // method call for every neuron processed. Again, done for speed.
+            bool reserveSignalSlots()
+            {
+                /**
+                 * @brief Phase 2 of a tick: number the outbox entries and reserve their srb slots.
+                 * 
+                 * @return  false when the slots have to be allocated one at a time instead: the Grow
+                 *          policy decides slot by slot, and a tick that emits more signals than the
+                 *          ring holds would give two partitions the same slot.
+                 * 
+                 * @throws  std::length_error when the tick emits more than srb::handleSweepLaps laps of the
+                 *          ring - handles queued this tick could outlive their 8 bit generation before
+                 *          dropStaleHandles gets to them.
+                 * 
+                 * @details Partition order is neuron order, so srb slots are handed out in the same order
+                 * whatever the partition count - one reservation per partition, O(partitions).
+                 */
+                std::int64_t total{0};
+                for (std::int32_t p = 0; p < tickPartitions.count(); ++p)
+                {
+                    tickPartitions[p].firstSequence = static_cast<std::int32_t>(total);
+                    total += static_cast<std::int64_t>(tickPartitions[p].outbox.size());
+                }
+                if (total > srb::handleSweepLaps * signalBufferCapacity)
+                {
+                    throw std::length_error("Neurons: a tick emits " + std::to_string(total) + " signals, more than " +
+                                            std::to_string(srb::handleSweepLaps) + " laps of the srb");
+                }
+                if (srbWrapPolicy == srb::WrapPolicy::Grow || total > signalBufferCapacity)
+                {
+                    return false;
+                }
+                for (std::int32_t p = 0; p < tickPartitions.count(); ++p)
+                {
+                    tick::Partition& partition = tickPartitions[p];
+                    partition.slots = signalObject.reserveSlots(static_cast<std::int32_t>(partition.outbox.size()));
+                }
+                return true;
+            }
 
-                    //     // ++neuronBeingProcessed; // step to next neuron slot
-                    //     // This is already incremented at the start of the for-loop
+            void emitPartition(tick::Partition& partition, bool reserved)
+            {
+                /**
+                 * @brief Phase 3 of a tick: write the partition's signals into the srb and post each one to
+                 * the inbox of the partition that owns its target.
+                 * 
+                 * @details With reserved slots this only touches the partition's own srb block, its own
+                 * chunks and the lock-free inboxes, so every partition emits at once.
+                 */
+                std::int32_t sequence = partition.firstSequence;
+                for (const tick::Delivery& delivery : partition.outbox)
+                {
+                    srb::SignalHandle handle = reserved ? connObject.emitSignal(delivery, partition.slots)
+                                                        : connObject.emitSignal(delivery);
+                    TCN_TRACE(DEBUG, "\nSignal generated to neuron:= " << std::to_string(delivery.target));
+                    std::int32_t destination = tickPartitions.partitionOf(delivery.target);
+                    partition.writer.append(tickPartitions[destination].arrivals, destination,
+                        tick::Arrival{delivery.target, handle, delivery.actionTime, sequence++});
+                }
+                partition.writer.flush([](std::int32_t destination) -> tick::ArrivalInbox& {
+                    return tickPartitions[destination].arrivals; });
+            }
 
-                    // This is the end of processing for each neuron.
-                    // Now is the time to scan incomingSignals and update all neuron neuron nextEvent
-                    // nextEvent will only bt INT32_MAX if no new signals were enqueued.
-                    
-                    if (!(nRef.incomingSignals.empty()) && nRef.nextEvent == INT32_MAX)
+            void deliverPartition(tick::Partition& partition)
+            {
+                // Phase 4 of a tick: enqueue the partition's inbox on its own neurons, in emission order
+                partition.arrivals.drain(partition.inbox);
+                for (const tick::Arrival& arrival : partition.inbox)
+                {
+                    if (connObject.enqueueSignal(arrival.target, arrival.handle, arrival.actionTime))
                     {
-                        // We are only going to scan for nextEvent updates if needed
-                        for (std::int32_t sRef : nRef.incomingSignals)
+                        partition.reschedule.push_back(wheel::WheelEntry{arrival.target, arrival.actionTime});
+                    }
+                }
+            }
+
+            void finishTick()
+            {
+                // Phase 5 of a tick: the shared state - connection weights and the event wheel
+                // strengthen the connections that caused the cascades - one batch in connection id
+                // order, so the pool is walked forward rather than hit at random
+                learningBatch.clear();
+                for (std::int32_t p = 0; p < tickPartitions.count(); ++p)
+                {
+                    const std::vector<std::int32_t>& contributors = tickPartitions[p].contributors;
+                    learningBatch.insert(learningBatch.end(), contributors.begin(), contributors.end());
+                }
+                std::sort(learningBatch.begin(), learningBatch.end());
+                connObject.strengthen(learningBatch.data(), learningBatch.data() + learningBatch.size());
+                // Oct 2026: the active set picks up every neuron the wheel is told about and every due
+                // neuron still holding signals or refractory - the cascades. They join in neuron id
+                // order, so the set, and the purge sweep that walks it, is the same for any partitioning.
+                active::ActiveSet& members = m_neuronPool.activeNeurons;
+                tickActivity = active::ActivityStats{};
+                tickActivity.due = static_cast<std::int32_t>(dueNeurons.size());
+                joinBatch.clear();
+                for (std::int32_t p = 0; p < tickPartitions.count(); ++p)
+                {
+                    tickActivity.cascades += tickPartitions[p].cascades;
+                    for (const wheel::WheelEntry& entry : tickPartitions[p].reschedule)
+                    {
+                        eventWheel.schedule(entry.neuronId, entry.actionTime);
+                        if (!members.contains(entry.neuronId))
                         {
-                            // pick lower of current nextEvent or this signal's actionTime
-                            // Avoid updating neuron nextEvent where signal actionTime is less than
-                            // current masterClock. This edge case can occur when purge has left intact
-                            // old signals that might still be eligible for aggregation but are older
-                            // than the current masterClock.
-
-                            (nRef.nextEvent < m_srb[sRef].actionTime && 
-                                m_srb[sRef].actionTime > masterClock) ?
-                                    nRef.nextEvent :    // Leave it alone
-                                        nRef.nextEvent = m_srb[sRef].actionTime;
+                            joinBatch.push_back(entry.neuronId);
                         }
                     }
-                }   // end of neuron forEach loop
-                
-                std::cout << "\nLast Neuron processed:= " << std::to_string(neuronBeingProcessed) << std::endl;
-                std::cout << "End of neuron scan \n";
+                }
+                for (std::int32_t neuronId : dueNeurons)
+                {
+                    if (!members.contains(neuronId) &&
+                        (!m_neuronPool.incomingSignals[neuronId].empty() || refractory(neuronId)))
+                    {
+                        joinBatch.push_back(neuronId);
+                    }
+                }
+                std::sort(joinBatch.begin(), joinBatch.end());
+                joinBatch.erase(std::unique(joinBatch.begin(), joinBatch.end()), joinBatch.end());
+                for (std::int32_t neuronId : joinBatch)
+                {
+                    members.insert(neuronId);
+                }
+                tickActivity.joined = static_cast<std::int32_t>(joinBatch.size());
 
+                // Anything still in the wheel, including signals generated during this scan,
+                // is the next clock tick worth visiting.
+                globalNextEvent = eventWheel.nextEventTime();
+                if (srbStats.wraps - srbStats.handleSweepWraps >= srb::handleSweepLaps)
+                {
+                    dropStaleHandles();
+                }
+                sweepStaleSignals(tconst::purgeSweepNeurons, tconst::purgeSweepBudget);
+                tickActivity.members = members.size();
+            }
 
+            const active::ActivityStats& activity() const { return tickActivity; }
+
+            static bool refractory(std::int32_t neuronId)
+            {
+                // refractoryEnd INT32_MAX is a neuron that never processes, not a refractory one
+                const std::int32_t refractoryEnd = m_neuronPool.refractoryEnd[neuronId];
+                return masterClock <= refractoryEnd && refractoryEnd != INT32_MAX;
+            }
+
+            std::int64_t dropStaleHandles()
+            {
+                /**
+                 * @brief Remove every stale handle from every neuron's queue.
+                 * 
+                 * @return  handles removed
+                 * 
+                 * @details Oct 2026: handle generations are 8 bits, so a handle left queued for 256 laps of
+                 * the ring would read as current again. The purge sweep cannot rule that out - it visits
+                 * a budgeted few active members a tick - so finishTick calls this every srb::handleSweepLaps
+                 * laps, and callers driving the ring outside the tick loop should too. It walks the whole
+                 * pool rather than the active set: a neuron that left the set with stale handles still
+                 * queued is not exempt. Current handles keep their order and a queue left empty gives its
+                 * block back to the arena. O(queued handles), once every handleSweepLaps laps.
+                 */
+                std::int64_t dropped{0};
+                for (std::int32_t neuronId = 0; neuronId < m_neuronPool.size(); ++neuronId)
+                {
+                    arena::SignalQueue incomingSignals = m_neuronPool.incomingSignals[neuronId];
+                    if (incomingSignals.empty())
+                    {
+                        continue;
+                    }
+                    std::int32_t* kept = std::remove_if(incomingSignals.begin(), incomingSignals.end(),
+                        [](srb::SignalHandle handle) { return !srb::isCurrent(handle); });
+                    dropped += incomingSignals.end() - kept;
+                    incomingSignals.resize(static_cast<std::size_t>(kept - incomingSignals.begin()));
+                    if (incomingSignals.empty())
+                    {
+                        incomingSignals.release();
+                    }
+                }
+                srbStats.handleSweepWraps = srbStats.wraps;
+                return dropped;
+            }
+
+            std::int32_t sweepStaleSignals(std::int32_t neuronLimit, std::int32_t entryBudget)
+            {
+                /**
+                 * @brief The incremental purge: visit the next neuronLimit members of the active set from
+                 * the pool's purgeCursor and drop at most entryBudget stale queue entries between them.
+                 * 
+                 * @return  queue entries reclaimed
+                 * 
+                 * @details Oct 2026: Purging used to happen on the tick's own path - every refractory visit
+                 * and every cascade purged the neuron's queue. Correctness no longer depends on it (the
+                 * aggregation window and nextEvent skip what a purge would have dropped), so it is now a
+                 * background pass run serially at the end of every tick, the cursor carrying on round the
+                 * active set from tick to tick. A queue is purged when it holds more than purgeThreshold
+                 * entries, or when its oldest entry is more than stalePurgeThreshold ticks past, and a queue
+                 * that ends up empty gives its block back to the arena. A member with an empty queue and
+                 * no refractory period left is idle and leaves the set - idle neurons are never visited.
+                 * Each visit is an O(1) test plus, for a purge, one search and an O(1) drop_front, so the
+                 * sweep costs the same every tick whatever the pool and queue sizes. Being serial and in
+                 * active set order, it drops the same entries however the tick is partitioned.
+                 */
+                active::ActiveSet& members = m_neuronPool.activeNeurons;
+                std::int32_t& cursor = m_neuronPool.purgeCursor;
+                std::int32_t reclaimed{0};
+                for (std::int32_t v = 0; v < neuronLimit && !members.empty() && reclaimed < entryBudget; ++v)
+                {
+                    cursor = (cursor < members.size()) ? cursor : 0;
+                    const std::int32_t neuronId = members[cursor];
+                    arena::SignalQueue incomingSignals = m_neuronPool.incomingSignals[neuronId];
+                    if (incomingSignals.size() > tconst::purgeThreshold ||
+                        (!incomingSignals.empty() &&
+                         srb::handleActionTime(incomingSignals[0]) < masterClock - tconst::stalePurgeThreshold))
+                    {
+                        reclaimed += purgeOldSignals(neuronId, entryBudget - reclaimed);
+                    }
+                    if (incomingSignals.empty() && !refractory(neuronId))
+                    {
+                        members.erase(neuronId);     // the last member moves in under the cursor
+                        ++tickActivity.left;
+                    }
+                    else
+                    {
+                        ++cursor;
+                    }
+                }
+                return reclaimed;
+            }
 
-      
+            std::int32_t advanceMasterClock()
+            {
+                /**
+                 * @brief Jump the masterClock straight to the next clock tick that has work.
+                 * 
+                 * @details The event wheel knows the earliest non-empty bucket so there is no need to
+                 * step through idle clock ticks. Returns INT32_MAX, leaving the clock alone, when
+                 * nothing is scheduled.
+                 */
+                globalNextEvent = eventWheel.nextEventTime();
+                if (globalNextEvent != INT32_MAX)
+                {
+                    masterClock = globalNextEvent;
+                }
+                return globalNextEvent;
             }
 
-            void purgeOldSignals (neuron::Neuron nRef)
+            static const std::int32_t* aggregationWindowStart(const arena::SignalQueue& incomingSignals,
+                                                              const std::int32_t* windowEnd, std::int32_t refractoryEnd)
+            /**
+             * @brief Walk back from windowEnd (first signal after the masterClock) to the first signal inside
+             * the aggregation window - never more than the window's own signals plus one.
+             * 
+             * @details Oct 2026: signals due at or before refractoryEnd arrived while the neuron was
+             * refractory and are outside the window too - they used to be purged when they came due.
+             * Stale handles carry no time and are walked over; the aggregation counts them as nothing.
+             */
             {
+                const std::int32_t* first = incomingSignals.begin();
+                const std::int32_t windowFloor = (refractoryEnd > masterClock - tconst::aggregation_window_ticks)
+                                                     ? refractoryEnd : masterClock - tconst::aggregation_window_ticks;
+                while (windowEnd != first &&
+                       (!srb::isCurrent(*(windowEnd - 1)) || srb::handleActionTime(*(windowEnd - 1)) > windowFloor))
+                {
+                    --windowEnd;
+                }
+                return windowEnd;
+            }
 
+            static constexpr std::ptrdiff_t linearSearchLimit{32};   // queue length where binary search takes over
+
+            static const std::int32_t* firstSignalAtOrAfter(const arena::SignalQueue& incomingSignals, std::int32_t clock)
             /**
-             * @brief   Purge old signals by dropping their reference from the incomingSignals vector. 
-             * They are just dropped and left in the SRB to be reused by someone else.
+             * @brief Search an actionTime ordered queue for the first current signal due at or after
+             * clock. Returns incomingSignals.end() if every current signal is earlier.
              * 
-             * @details Purging is a relatively expensive operation as the vector is shifted potentially
-             * multiple times. We only purge if the number of signals > purgeThreshold but are careful
-             * to leave in queue any future signals.
-             * The only reason to purge is if the incomingSignal queue gets bloated with old signals. When the 
-             * SRB (SignalRingBuffer) wraps, unpurged signals will have the old signal information in them inluding the owner. 
-             * It's important that when neurons process the incomingSignal queue they make sure they are the owner
-             * of the signal as really old signals that didn't get purged might have been reused after an SRB wrap.
+             * @details Short queues - the usual case - are walked from the front as that stops early and
+             * predicts well; binary search only pays for itself on long queues.
              * 
-             * When we purge a neuron during refractory we can purge all signals up to and including the refractory end,
-             * including any that would normally fall into the aggregation window as they should never become enqueued or,
-             * if they were in the past, they will be unusable while the neuron is refractory. This means the purge
-             * routine does not have to reach back to preserve aggregation window signals.
+             * Oct 2026: a handle that went stale after it was queued - its slot reused by a later lap of
+             * the ring - sits anywhere in the queue and has no time, so only the current handles are in
+             * order. The walk passes stale handles (they read INT32_MIN), and the binary search probes the
+             * first current handle at or after its midpoint: every current handle before lo is due before
+             * clock, every current handle from hi on at or after it.
+             */
+            {
+                const std::int32_t* first = incomingSignals.begin();
+                const std::int32_t* last = incomingSignals.end();
+                if (last - first <= linearSearchLimit)
+                {
+                    while (first != last && srb::handleActionTime(*first) < clock)
+                    {
+                        ++first;
+                    }
+                    return first;
+                }
+                const std::int32_t* lo = first;
+                const std::int32_t* hi = last;
+                while (lo < hi)
+                {
+                    const std::int32_t* mid = lo + (hi - lo) / 2;
+                    const std::int32_t* probe = mid;
+                    while (probe != hi && !srb::isCurrent(*probe))
+                    {
+                        ++probe;
+                    }
+                    if (probe != hi && srb::handleActionTime(*probe) < clock)
+                    {
+                        lo = probe + 1;
+                    }
+                    else
+                    {
+                        hi = mid;
+                    }
+                }
+                while (lo != last && !srb::isCurrent(*lo))
+                {
+                    ++lo;
+                }
+                return lo;
+            }
+
+            std::int32_t purgeOldSignals (std::int32_t neuronId, std::int32_t entryBudget = INT32_MAX)
+            {
+
+            /**
+             * @brief   Purge old signals by dropping their handles from the front of the neuron's
+             * incomingSignals queue. The signals themselves are left in the SRB to be reused.
              * 
-             * @cond When to purge? If the incomingSignal vector get's larger than the purgeThreshold otherwise
-             * just let them lay there for now.
-             * The only reason to purge is to save memory in the incomingSignals ref queue. SRB ownership and SRB
-             * wrap takes care of reusing the actual signals and neuron signal processing ignores and potentially
-             * purges older signals. Otherwise, old signal refs just stay fallow in their respective neuron
-             * incomingSignal queues - and they are just indexes not the actual signals themselves, which remain in 
-             * the SRB. 
+             * @return  the number of queue entries dropped
              * 
-             * Efficient algorithm: We purge when we are in refractory. Any signals older than current masterClock
-             * can be dropped, even those that contributed to the current aggregation.
-             * As the incomingSignals vector is not sorted there could be earlier signals enqueued with
-             * an actionTime beyond the masterClock so they have to be left intact.
-             * There is another simple test that can be made when every neuron is examined in the scan. If the
-             * neuron nextEvent is less than the masterClock then the time has passed for this neuron to cascade so
-             * we can drop all of the old signals in the incomingSignals queue as they will never again contribute to
-             * a clock time thas has passed.
-             * This immediate purge can be done in-line.
+             * @details Oct 2026: The queue is kept in actionTime order, so everything that can never
+             * contribute again is a prefix: signals before the aggregation window and - refractory or
+             * not - signals due at or before the refractory end, which never aggregate. The purge is one
+             * binary search for the first signal to keep (firstSignalAtOrAfter, which steps over stale
+             * handles) and an O(1) drop_front, stale handles in the prefix going with it. The queue is
+             * purged in place, and one that ends up empty hands its block back to the arena free list.
+             * 
+             * Purging only saves queue space; nothing depends on it for correctness. The aggregation
+             * window and nextEvent skip what a purge would drop, srb::isCurrent rejects a handle whose
+             * slot has been reused, and dropStaleHandles clears stale handles a prefix does not reach.
+             * So callers purge a queue only when it holds more than purgeThreshold entries or its
+             * front is long past (sweepStaleSignals), and at most entryBudget entries are dropped, for
+             * the sweep's per tick budget - the rest of the prefix waits for the sweep's next lap.
              */
             
              // Callers should make purge threshold test to avoid unnecessary calls
 
-                std::int32_t oldestSignal = 0;
+                std::int32_t refractoryEnd = m_neuronPool.refractoryEnd[neuronId];
+                arena::SignalQueue incomingSignals = m_neuronPool.incomingSignals[neuronId];
 
+                // anything with an actionTime before keepFrom can never contribute again
+                // - and nothing up to and including the refractory end ever aggregates, refractory or not
+                std::int32_t keepFrom = masterClock - tconst::aggregation_window_ticks + 1;
+                keepFrom = (refractoryEnd < keepFrom) ? keepFrom : (refractoryEnd < INT32_MAX) ? refractoryEnd + 1 : INT32_MAX;
 
-                // Start with the simplest test:
-                if (nRef.nextEvent == INT32_MAX)
-                {
-                    // This means there are no future signals that have been found so we can purge all
-                    std::vector<std::int32_t>().swap(nRef.incomingSignals);
-                    return;     // early out
-                }
-
-                // Use c++ forEach for cleaner code
-                // oldestSignal mean smallest clock time
-
-                for (std::int32_t sRef : nRef.incomingSignals)
-                {
-                    oldestSignal = (m_srb[sRef].actionTime < oldestSignal &&
-                                      m_srb[sRef].actionTime > masterClock) ?
-                                        m_srb[sRef].actionTime :
-                                            oldestSignal;
-                }
+                const std::int32_t* firstKept = firstSignalAtOrAfter(incomingSignals, keepFrom);
+                std::ptrdiff_t dropped = firstKept - incomingSignals.begin();
+                dropped = (dropped < entryBudget) ? dropped : entryBudget;
+                incomingSignals.drop_front(static_cast<std::size_t>(dropped));
 
-                // Upon exit oldestSignal should have the smallest future clock value from incoming signals
-                // that is bigger than the current masterClock
-                if (oldestSignal < (masterClock - aggregationDistance))
-                {
-                    // no signals that can ever contribute to cascade within the next clock tick - so purge all
-                    // m_neuronPool[neuronBeingProcessed].incomingSignals.clear();
-                    // Clear does no reduce capacity; use the swap trick
-
-                    std::vector<std::int32_t>().swap(nRef.incomingSignals);
-
-                    // **** But reinstate incomingSignals[] to point to srb[0] 
-                    // So that subsequent pushes always leave incoming[0] pointing to proto signal
-                    m_neuronPool[neuronBeingProcessed].incomingSignals.push_back(0);
-                }
-                else
+                if (incomingSignals.empty())
                 {
-                    // oldest signal we found in signals is older then current neuron nextEvent
-                    nRef.nextEvent = (nRef.nextEvent < oldestSignal) ?
-                                        nRef.nextEvent : 
-                                            oldestSignal;
+                    // empty queue gives its block back to the arena free list
+                    incomingSignals.release();
                 }
+                return static_cast<std::int32_t>(dropped);
             }
         
 
@@ -0,0 +1,83 @@
+#ifndef POOLSTORAGE_H_INCLUDED
+#define POOLSTORAGE_H_INCLUDED
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief PoolStorage
+ *
+ * Bulk start up initialization for the big pools - connections, the srb, the neuron arrays and
+ * the signal arena slab.
+ *
+ * @details Oct 2026: The pool constructors used to reserve and then push_back a prototype
+ * element up to capacity(), one size check and one copy at a time. fill() reserves the storage
+ * once and assigns every element in one pass, which for these trivially copyable structs is a
+ * plain memory fill the compiler vectorizes.
+ *
+ * Huge pages are a build option: with -DTCN_HUGE_PAGES=1 fill() asks the kernel to back the
+ * pool with transparent huge pages (madvise MADV_HUGEPAGE) before the first touch, so a 10M
+ * element pool costs a few hundred TLB entries instead of hundreds of thousands. Only the 2 MB
+ * aligned part of the storage can be advised. Where madvise is not available the option does
+ * nothing.
+ */
+
+#ifndef TCN_HUGE_PAGES
+    #define TCN_HUGE_PAGES 0
+#endif
+
+namespace pools
+{
+    inline constexpr bool hugePages{TCN_HUGE_PAGES != 0};
+    inline constexpr std::size_t hugePageBytes{std::size_t{2} << 20};
+
+    inline bool adviseHugePages(void* data, std::size_t bytes)
+    {
+        // true if some of [data, data + bytes) was advised
+        #if defined(__linux__) && defined(MADV_HUGEPAGE)
+        std::uintptr_t first = (reinterpret_cast<std::uintptr_t>(data) + hugePageBytes - 1) & ~(hugePageBytes - 1);
+        std::uintptr_t last = (reinterpret_cast<std::uintptr_t>(data) + bytes) & ~(hugePageBytes - 1);
+        return last > first && madvise(reinterpret_cast<void*>(first), last - first, MADV_HUGEPAGE) == 0;
+        #else
+        (void)data;
+        (void)bytes;
+        return false;
+        #endif
+    }
+
+    template <typename T>
+    void fill(std::vector<T>& pool, std::size_t count, const T& blank)
+    {
+        /**
+         * @brief Make pool count copies of blank in one allocation and one pass.
+         *
+         * @details Any old storage is released first so the pool is sized afresh, not kept at
+         * some earlier, bigger capacity.
+         */
+        std::vector<T>().swap(pool);
+        pool.reserve(count);
+        if constexpr (hugePages)
+        {
+            adviseHugePages(pool.data(), count * sizeof(T));
+        }
+        pool.assign(count, blank);
+    }
+
+    template <typename T>
+    void reserve(std::vector<T>& pool, std::size_t count)
+    {
+        // storage without elements - nothing is touched until the pool grows into it
+        pool.reserve(count);
+        if constexpr (hugePages)
+        {
+            adviseHugePages(pool.data(), pool.capacity() * sizeof(T));
+        }
+    }
+}   // end pools namespace
+
+#endif // POOLSTORAGE_H_INCLUDED
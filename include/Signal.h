@@ -7,22 +7,29 @@
 
 /**
  * @brief:  Used to carry a signal event from a cascading neuron to all of its targets.
- * 
+ *
  * @details: actionTime: is relative; masterClock is always added to get true clock time.
  * owner: used to make sure signal belongs to the target to guard against srb wrap
  * sourceConnId:  used to allow group strengthening when there is repeat cascades for the target
  * amplitude:     size of the signal as determined by the delivering connection
  * testId:        used for testing to trace things
+ *
+ * Oct 2026: 8 bytes a signal, the budget in the aTCN.h sizing estimates (it was 16).
+ * epochTime:     the actionTime less signalEpoch, a tick kept within epochSpan of the masterClock -
+ *                srb::actionTime() gives the clock time back (SignalRingBuffer.h)
+ * owner:         gone - it is the target of the source connection (Connections::signalOwner) and the
+ *                generation tagged handles have replaced it as the guard against srb wrap
+ * testId:        moved to the m_srbTestIds side table, kept only with TCN_SIGNAL_TEST_IDS
  */
 namespace signal
 {
   struct Signal {
-    std::int32_t actionTime{};     // time when neuron needs to process this signal
-    std::int32_t owner{};          // used when srb wraps and signal changes ownership
-    std::int32_t sourceConnId{};   // used for group strengthening for STP/LTP 
+    std::int32_t sourceConnId{};   // used for group strengthening for STP/LTP; its target owns the signal
+    std::int16_t epochTime{};      // time when neuron needs to process this signal, less signalEpoch
     std::int16_t amplitude{};      // signal size modified by connection weight at origination.
-    std::int16_t testId{};         // used for tracking test signals.
   };
+
+  static_assert(sizeof(Signal) == 8, "a signal is two words");
 } // end of namespace
 
 #endif
@@ -0,0 +1,439 @@
+#ifndef SIGNALARENA_H_INCLUDED
+#define SIGNALARENA_H_INCLUDED
+
+#include <iostream>
+#include <cstdint>
+#include <climits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "TCNConstants.h"
+#include "PoolStorage.h"
+
+/**
+ * @brief SignalArena
+ *
+ * Slab allocator for the per neuron incomingSignals queues.
+ *
+ * @details Oct 2026: Every neuron used to own a std::vector of srb indexes. generateASignal grew
+ * it with push_back and purgeOldSignals gave it back with the swap trick, so bursty cascades
+ * turned into a steady stream of malloc/free calls - one or more per signal enqueued on a
+ * quiet neuron.
+ *
+ * All queues for a TCN now live in one slab of int32 srb indexes owned by the neuron pool.
+ * Each neuron holds a 16 byte header {offset, head, size, sizeClass} instead of a 24 byte vector.
+ * Blocks come in power of two size classes, minChunk << sizeClass entries:
+ *    - a queue that fills its block moves to a block of the next class and its old block
+ *      goes back on the free list for its class
+ *    - release() puts an emptied queue's block back on its free list
+ *    - allocation pops the free list, else bumps the slab
+ * All of those are O(1) and, once the slab and free lists are warm, never touch the heap.
+ *
+ * The slab is sized at start up from tcnconstants::neuron_signal_ratio (entries per neuron).
+ * It only grows if that guess is too small, and the growth count is reported with the
+ * high-water marks so the ratio can be tuned.
+ * Oct 2026: The start up sizing only reserves. The slab's size is the bump pointer, and each
+ * new block is value initialized as it is handed out, so a queue's memory is first touched when
+ * the queue first gets a signal and a pool of idle neurons costs no start up time at all.
+ *
+ * Queues hand out raw pointers for iteration. They stay valid until the next push_back on
+ * any queue in the same arena, because that may move the slab. Iteration must not push,
+ * which the neuron scan never does.
+ *
+ * Oct 2026: Queues are kept in actionTime order. insert_sorted() places a new entry by walking
+ * back from the tail, which is one compare in the common case as signals mostly arrive in time
+ * order. Each header also carries a head index into its block, so a purge drops a prefix by
+ * bumping head (drop_front) and the live entries are [head, head + size). The block is only
+ * compacted when the tail runs into the end of the block with free space at the front.
+ *
+ * Oct 2026: The arena can be split into shards by neuron range (partition()). Each shard is a
+ * complete arena of its own - slab, free lists, bump pointer and stats - and the header records
+ * which shard its block is in (sizeClass shrank to 16 bits, so the header is still 16 bytes).
+ * Queues in different shards never share state, which is what lets the parallel tick engine
+ * enqueue from one worker per partition without locks. Raw pointers now only go stale on a
+ * push_back to a queue in the same shard.
+ */
+
+namespace arena
+{
+    inline constexpr std::int32_t minChunkBits{2};
+    inline constexpr std::int32_t minChunk{1 << minChunkBits};   // 4 entries - 16 bytes
+    inline constexpr std::int32_t sizeClasses{24};                // largest block is 4 << 23 entries
+    inline constexpr std::int32_t noBlock{-1};
+
+    struct QueueHeader {
+        std::int32_t offset{0};             // start of the block in its shard's slab
+        std::int32_t head{0};               // first live entry within the block
+        std::int32_t size{0};               // entries in use
+        std::int16_t sizeClass{noBlock};    // block capacity is minChunk << sizeClass
+        std::int16_t shard{0};              // which slab the block lives in
+    };
+
+    struct ArenaStats {
+        std::int64_t slabEntries{0};        // current slab capacity in entries
+        std::int64_t slabUsedHighWater{0};  // furthest the bump pointer has reached
+        std::int64_t liveEntries{0};        // signals queued right now
+        std::int64_t liveHighWater{0};      // most signals ever queued at once
+        std::int32_t longestQueue{0};       // longest single queue ever seen
+        std::int64_t slabGrowths{0};        // times the start up sizing was too small
+        std::int64_t blocksInUse[sizeClasses]{};
+        std::int64_t blocksHighWater[sizeClasses]{};
+    };
+
+    class SignalArena;
+
+    class SignalQueue
+    /**
+     * @brief Vector-like view of one neuron's queue. Cheap to copy - it is just the arena and
+     * the neuron id - and every call goes back to the header so it never goes stale.
+     */
+    {
+        public:
+
+        SignalQueue(SignalArena* arena, std::int32_t neuronId) : m_arena(arena), m_neuronId(neuronId) {}
+
+        inline void push_back(std::int32_t signalSlot);
+        template <typename KeyFn>
+        inline void insert_sorted(std::int32_t signalSlot, const KeyFn& keyOf);
+        inline void drop_front(std::size_t count);
+        inline std::size_t size() const;
+        inline bool empty() const;
+        inline std::size_t capacity() const;
+        inline std::int32_t* begin() const;
+        inline std::int32_t* end() const;
+        inline std::int32_t& operator[](std::size_t idx) const;
+        inline std::int32_t& back() const;
+        inline void resize(std::size_t newSize);    // shrink only
+        inline void release();
+
+        private:
+
+        SignalArena* m_arena;
+        std::int32_t m_neuronId;
+    };
+
+    class SignalArena
+    {
+        public:
+
+        SignalArena() : m_shards(1) {}
+
+        ~SignalArena()
+        {
+            ;   // slabs and headers are released when they go out of scope
+        }
+
+        void swap(SignalArena& other)
+        {
+            // exchange every queue and shard with another arena - nothing is copied
+            m_headers.swap(other.m_headers);
+            m_shards.swap(other.m_shards);
+            std::swap(m_signalsPerNeuron, other.m_signalsPerNeuron);
+        }
+
+        void resize(std::int32_t neuronCount, std::int32_t signalsPerNeuron = tcnconstants::neuron_signal_ratio)
+        /**
+         * @brief Drop every queue and size the slab for neuronCount neurons - one shard.
+         */
+        {
+            m_headers.assign(neuronCount, QueueHeader{});
+            m_signalsPerNeuron = signalsPerNeuron;
+            m_shards.assign(1, Shard{});
+            sizeShard(m_shards[0], neuronCount);
+        }
+
+        void partition(const std::vector<std::int32_t>& firstNeurons)
+        /**
+         * @brief Split the arena into one shard per neuron range; firstNeurons[i] is the first neuron
+         * of shard i and firstNeurons[0] must be 0.
+         *
+         * @details Oct 2026: each shard has its own slab, free lists and stats, so queues in different
+         * shards can be pushed, purged and released from different threads at the same time. The
+         * parallel tick gives every partition its own shard. Queued entries are moved into their
+         * new shard, so this can be called on a running network, but it is not cheap.
+         */
+        {
+            std::int32_t shardCount = static_cast<std::int32_t>(firstNeurons.size());
+            std::int32_t neuronCount = size();
+            std::vector<Shard> shards(shardCount);
+            for (std::int32_t s = 0; s < shardCount; ++s)
+            {
+                std::int32_t last = (s + 1 < shardCount) ? firstNeurons[s + 1] : neuronCount;
+                sizeShard(shards[s], last - firstNeurons[s]);
+            }
+
+            std::vector<std::int32_t> entries;
+            std::int32_t shard{0};
+            for (std::int32_t n = 0; n < neuronCount; ++n)
+            {
+                while (shard + 1 < shardCount && firstNeurons[shard + 1] <= n)
+                {
+                    ++shard;
+                }
+                QueueHeader& h = m_headers[n];
+                entries.assign(data(n), data(n) + h.size);
+                h = QueueHeader{};
+                h.shard = static_cast<std::int16_t>(shard);
+                for (std::int32_t entry : entries)
+                {
+                    std::int32_t* slab = nullptr;
+                    QueueHeader& moved = makeRoom(shards[shard], n, slab);
+                    slab[moved.offset + moved.head + moved.size++] = entry;
+                }
+            }
+            m_shards.swap(shards);
+        }
+
+        std::int32_t size() const { return static_cast<std::int32_t>(m_headers.size()); }
+        std::int32_t shards() const { return static_cast<std::int32_t>(m_shards.size()); }
+
+        SignalQueue operator[](std::int32_t neuronId) { return SignalQueue(this, neuronId); }
+
+        const QueueHeader& header(std::int32_t neuronId) const { return m_headers[neuronId]; }
+
+        std::int32_t* data(std::int32_t neuronId)
+        {
+            const QueueHeader& h = m_headers[neuronId];
+            return m_shards[h.shard].slab.data() + h.offset + h.head;
+        }
+
+        void push_back(std::int32_t neuronId, std::int32_t signalSlot)
+        {
+            // append at the tail - callers appending out of actionTime order must use insert_sorted
+            std::int32_t* slab = nullptr;
+            QueueHeader& h = makeRoom(m_shards[m_headers[neuronId].shard], neuronId, slab);
+            slab[h.offset + h.head + h.size++] = signalSlot;
+        }
+
+        template <typename KeyFn>
+        void insert_sorted(std::int32_t neuronId, std::int32_t signalSlot, const KeyFn& keyOf)
+        {
+            // keyOf(slot) is the actionTime; equal keys keep arrival order
+            std::int32_t* slab = nullptr;
+            QueueHeader& h = makeRoom(m_shards[m_headers[neuronId].shard], neuronId, slab);
+            std::int32_t* first = slab + h.offset + h.head;
+            std::int32_t key = keyOf(signalSlot);
+            std::int32_t pos = h.size;
+            while (pos > 0 && keyOf(first[pos - 1]) > key)
+            {
+                first[pos] = first[pos - 1];
+                --pos;
+            }
+            first[pos] = signalSlot;
+            ++h.size;
+        }
+
+        void drop_front(std::int32_t neuronId, std::int32_t count)
+        {
+            // prefix drop - O(1), the block stays with the queue
+            QueueHeader& h = m_headers[neuronId];
+            count = (count < h.size) ? count : h.size;
+            m_shards[h.shard].stats.liveEntries -= count;
+            h.size -= count;
+            h.head = (h.size == 0) ? 0 : h.head + count;
+        }
+
+        void truncate(std::int32_t neuronId, std::int32_t newSize)
+        {
+            // keep the block - the queue is likely to refill before it is purged again
+            QueueHeader& h = m_headers[neuronId];
+            if (newSize < h.size)
+            {
+                m_shards[h.shard].stats.liveEntries -= h.size - newSize;
+                h.size = newSize;
+            }
+        }
+
+        void release(std::int32_t neuronId)
+        {
+            // hand the block back to the free list for its class
+            QueueHeader& h = m_headers[neuronId];
+            Shard& shard = m_shards[h.shard];
+            shard.stats.liveEntries -= h.size;
+            h.size = 0;
+            h.head = 0;
+            if (h.sizeClass != noBlock)
+            {
+                freeBlock(shard, h.offset, h.sizeClass);
+                h.sizeClass = noBlock;
+                h.offset = 0;
+            }
+        }
+
+        ArenaStats stats() const
+        {
+            // summed over the shards - high-water marks are per shard so the sum is an upper bound
+            ArenaStats total{};
+            for (const Shard& shard : m_shards)
+            {
+                total.slabEntries += shard.stats.slabEntries;
+                total.slabUsedHighWater += shard.stats.slabUsedHighWater;
+                total.liveEntries += shard.stats.liveEntries;
+                total.liveHighWater += shard.stats.liveHighWater;
+                total.longestQueue = (shard.stats.longestQueue > total.longestQueue) ?
+                                        shard.stats.longestQueue : total.longestQueue;
+                total.slabGrowths += shard.stats.slabGrowths;
+                for (std::int32_t c = 0; c < sizeClasses; ++c)
+                {
+                    total.blocksInUse[c] += shard.stats.blocksInUse[c];
+                    total.blocksHighWater[c] += shard.stats.blocksHighWater[c];
+                }
+            }
+            return total;
+        }
+
+        void printStats() const
+        {
+            ArenaStats total = stats();
+            std::cout << "\nSignal arena:";
+            if (m_shards.size() > 1)
+            {
+                std::cout << " " << m_shards.size() << " shards";
+            }
+            std::cout << "\n  slab entries:= " << total.slabEntries << " (" << total.slabEntries * 4 / 1024 << " KB)"
+                      << "  used high-water:= " << total.slabUsedHighWater
+                      << "  growths:= " << total.slabGrowths;
+            std::cout << "\n  live signals:= " << total.liveEntries
+                      << "  high-water:= " << total.liveHighWater
+                      << "  longest queue:= " << total.longestQueue;
+            std::cout << "\n  blocks in use / high-water by class:";
+            for (std::int32_t c = 0; c < sizeClasses; ++c)
+            {
+                if (total.blocksHighWater[c] != 0)
+                {
+                    std::cout << "\n    " << (minChunk << c) << " entries:= " << total.blocksInUse[c]
+                              << " / " << total.blocksHighWater[c];
+                }
+            }
+            std::cout << '\n';
+        }
+
+        private:
+
+        struct Shard {
+            std::vector<std::int32_t> slab;                     // entries of every queue in the shard, size() is the bump pointer
+            std::vector<std::int32_t> freeLists[sizeClasses];   // offsets of free blocks per class
+            ArenaStats stats{};
+        };
+
+        std::vector<QueueHeader> m_headers;                 // one per neuron
+        std::vector<Shard> m_shards;                        // one per neuron range
+        std::int32_t m_signalsPerNeuron{tcnconstants::neuron_signal_ratio};
+
+        void sizeShard(Shard& shard, std::int32_t neuronCount)
+        {
+            std::int64_t entries = static_cast<std::int64_t>(neuronCount) * m_signalsPerNeuron;
+            entries = (entries < INT32_MAX) ? entries : INT32_MAX;
+            pools::reserve(shard.slab, static_cast<std::size_t>(entries < minChunk ? minChunk : entries));
+            shard.stats.slabEntries = static_cast<std::int64_t>(shard.slab.capacity());
+        }
+
+        QueueHeader& makeRoom(Shard& shard, std::int32_t neuronId, std::int32_t*& slab)
+        {
+            // make sure there is a free entry after the tail and count it in the stats;
+            // slab is set after any growth so it is safe to write through
+            QueueHeader& h = m_headers[neuronId];
+            if (h.sizeClass == noBlock)
+            {
+                h.offset = allocateBlock(shard, 0);
+                h.sizeClass = 0;
+                h.head = 0;
+            }
+            else if (h.head + h.size == (minChunk << h.sizeClass))
+            {
+                if (h.size <= (minChunk << h.sizeClass) / 2)
+                {
+                    // at least half the block has been dropped off the front - slide back to the start
+                    std::copy(shard.slab.begin() + h.offset + h.head, shard.slab.begin() + h.offset + h.head + h.size,
+                              shard.slab.begin() + h.offset);
+                    h.head = 0;
+                }
+                else
+                {
+                    grow(shard, h);
+                }
+            }
+            ArenaStats& stats = shard.stats;
+            stats.longestQueue = (h.size + 1 > stats.longestQueue) ? h.size + 1 : stats.longestQueue;
+            ++stats.liveEntries;
+            stats.liveHighWater = (stats.liveEntries > stats.liveHighWater) ? stats.liveEntries : stats.liveHighWater;
+            slab = shard.slab.data();
+            return h;
+        }
+
+        void grow(Shard& shard, QueueHeader& h)
+        {
+            std::int16_t newClass = static_cast<std::int16_t>(h.sizeClass + 1);
+            std::int32_t newOffset = allocateBlock(shard, newClass);
+            for (std::int32_t i = 0; i < h.size; ++i)
+            {
+                shard.slab[newOffset + i] = shard.slab[h.offset + h.head + i];
+            }
+            freeBlock(shard, h.offset, h.sizeClass);
+            h.offset = newOffset;
+            h.head = 0;
+            h.sizeClass = newClass;
+        }
+
+        std::int32_t allocateBlock(Shard& shard, std::int32_t sizeClass)
+        {
+            ArenaStats& stats = shard.stats;
+            ++stats.blocksInUse[sizeClass];
+            stats.blocksHighWater[sizeClass] = (stats.blocksInUse[sizeClass] > stats.blocksHighWater[sizeClass]) ?
+                                                    stats.blocksInUse[sizeClass] : stats.blocksHighWater[sizeClass];
+
+            std::vector<std::int32_t>& freeList = shard.freeLists[sizeClass];
+            if (!freeList.empty())
+            {
+                std::int32_t offset = freeList.back();
+                freeList.pop_back();
+                return offset;
+            }
+
+            std::int64_t blockSize = std::int64_t{minChunk} << sizeClass;
+            std::int64_t used = static_cast<std::int64_t>(shard.slab.size());
+            if (used + blockSize > static_cast<std::int64_t>(shard.slab.capacity()))
+            {
+                // start up sizing was too small - double, the one place the arena reallocates
+                std::int64_t newSize = static_cast<std::int64_t>(shard.slab.capacity()) * 2;
+                newSize = (newSize > used + blockSize) ? newSize : used + blockSize;
+                pools::reserve(shard.slab, static_cast<std::size_t>(newSize));
+                stats.slabEntries = static_cast<std::int64_t>(shard.slab.capacity());
+                ++stats.slabGrowths;
+            }
+            // inside the reserved capacity, so only the new block is touched
+            shard.slab.resize(static_cast<std::size_t>(used + blockSize));
+            std::int32_t offset = static_cast<std::int32_t>(used);
+            stats.slabUsedHighWater = used + blockSize;
+            return offset;
+        }
+
+        void freeBlock(Shard& shard, std::int32_t offset, std::int32_t sizeClass)
+        {
+            --shard.stats.blocksInUse[sizeClass];
+            shard.freeLists[sizeClass].push_back(offset);
+        }
+    };
+
+    void SignalQueue::push_back(std::int32_t signalSlot) { m_arena->push_back(m_neuronId, signalSlot); }
+    template <typename KeyFn>
+    void SignalQueue::insert_sorted(std::int32_t signalSlot, const KeyFn& keyOf) { m_arena->insert_sorted(m_neuronId, signalSlot, keyOf); }
+    void SignalQueue::drop_front(std::size_t count) { m_arena->drop_front(m_neuronId, static_cast<std::int32_t>(count)); }
+    std::size_t SignalQueue::size() const { return static_cast<std::size_t>(m_arena->header(m_neuronId).size); }
+    bool SignalQueue::empty() const { return m_arena->header(m_neuronId).size == 0; }
+    std::size_t SignalQueue::capacity() const
+    {
+        const QueueHeader& h = m_arena->header(m_neuronId);
+        return (h.sizeClass == noBlock) ? 0 : static_cast<std::size_t>(minChunk << h.sizeClass);
+    }
+    std::int32_t* SignalQueue::begin() const { return m_arena->data(m_neuronId); }
+    std::int32_t* SignalQueue::end() const { return m_arena->data(m_neuronId) + m_arena->header(m_neuronId).size; }
+    std::int32_t& SignalQueue::operator[](std::size_t idx) const { return m_arena->data(m_neuronId)[idx]; }
+    std::int32_t& SignalQueue::back() const { return m_arena->data(m_neuronId)[m_arena->header(m_neuronId).size - 1]; }
+    void SignalQueue::resize(std::size_t newSize) { m_arena->truncate(m_neuronId, static_cast<std::int32_t>(newSize)); }
+    void SignalQueue::release() { m_arena->release(m_neuronId); }
+
+}   // end arena namespace
+
+#endif // SIGNALARENA_H_INCLUDED
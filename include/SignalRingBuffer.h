@@ -2,9 +2,12 @@
 #define SIGNALRINGBUFFER_H_INCLUDED
 
 #include "Signal.h"
+#include "Connection.h"
 #include <cstdint>
 #include <vector>
 #include <climits>
+#include <stdexcept>
+#include <string>
 
 /**
  * @brief SignalRingBuffer
@@ -20,12 +23,240 @@
  #include <iostream>
  #include <vector>
  #include "TCNConstants.h"
+ #include "PoolStorage.h"
 
  // Make signal ring buffer and control global    
 
 int32_t currentSignalSlot{0};          // [0] will remain the default blank until srb wraps
 int32_t signalBufferCapacity{};
 std::vector<signal::Signal> m_srb{};       // this remains a vector of the actual signals
+int32_t signalEpoch{0};                // Oct 2026: clock tick every Signal::epochTime is relative to
+
+/**
+ * Oct 2026: Signal test ids are a build option. With -DTCN_SIGNAL_TEST_IDS=1 (the default under
+ * TESTING_MODE) m_srbTestIds runs alongside m_srb and each slot's id is its slot number, as the
+ * testId field used to be; otherwise it stays empty and srb::testId() is 0. The ids are int32 so
+ * every one of the 2^24 addressable slots keeps a distinct id.
+ */
+#ifndef TCN_SIGNAL_TEST_IDS
+    #ifdef TESTING_MODE
+        #define TCN_SIGNAL_TEST_IDS 1
+    #else
+        #define TCN_SIGNAL_TEST_IDS 0
+    #endif
+#endif
+
+std::vector<std::int32_t> m_srbTestIds{};
+
+extern std::int32_t masterClock;       // defined with the neuron pool
+
+ namespace srb
+ {
+    /**
+     * Oct 2026: What allocateSignalSlot does when the slot it is about to hand out still holds a live
+     * signal - one that is in the future or still inside its target's aggregation window.
+     *    Overwrite   count it and reuse the slot - the original behaviour
+     *    Grow        count it, and at the next wrap append capacity instead of going back to slot 0
+     *                whenever the live window has reached growThreshold of the ring
+     *    FailFast    throw std::length_error - for test runs that must never lose a signal
+     */
+    enum class WrapPolicy { Overwrite, Grow, FailFast };
+
+    inline constexpr std::int32_t growThresholdPercent{75};   // live window share of the ring that triggers Grow
+
+    struct RingStats {
+        std::int64_t allocations{0};            // slots handed out
+        std::int64_t wraps{0};                  // times the cursor went back to slot 0
+        std::int64_t liveOverwrites{0};         // slots reused while their signal was still live
+        std::int64_t grows{0};                  // times Grow appended capacity
+        std::int32_t oldestLiveSlot{0};         // oldest slot that may still hold a live signal
+        std::int32_t liveWindow{0};             // slots from oldestLiveSlot up to the cursor
+        std::int32_t liveWindowHighWater{0};    // the largest the live window has been
+        std::int64_t handleSweepWraps{0};       // wraps at the last sweep of stale handles (Neurons::dropStaleHandles)
+    };
+ }
+
+srb::RingStats srbStats{};                                  // ring counters, shared by every SignalRingBuffer
+srb::WrapPolicy srbWrapPolicy{srb::WrapPolicy::Overwrite};  // what to do about live overwrites
+
+ namespace srb
+ {
+    /**
+     * Oct 2026: Signal times.
+     *
+     * A Signal holds its actionTime as a 16 bit offset from signalEpoch. rebaseSignals() moves the
+     * epoch up to the masterClock once the clock is epochSpan ticks past it, so the clock is always
+     * within [signalEpoch, signalEpoch + epochSpan) and
+     *      a signal due up to epochSpan - 1 ticks from now      is exact
+     *      a signal up to epochSpan ticks in the past           is exact
+     *      anything older                                       is longPast - it reads as INT32_MIN,
+     *                                                             like a stale handle or a blank slot
+     * Temporal distances must therefore stay within maxSignalDistance - connection::validDistance, which
+     * netbuild and pack() apply and the fan-out enforces at emission. A rebase touches every slot
+     * once every epochSpan ticks, well under one slot per signal.
+     */
+    inline constexpr std::int32_t epochSpan{1 << 14};
+    inline constexpr std::int32_t maxSignalDistance{epochSpan - 1};
+    static_assert(maxSignalDistance == connection::maxTemporalDistance, "connections are checked against maxSignalDistance");
+    inline constexpr std::int16_t longPast{INT16_MIN};
+    inline constexpr bool signalTestIds{TCN_SIGNAL_TEST_IDS != 0};
+
+    inline std::int16_t toEpochTime(std::int32_t actionTime)
+    {
+        std::int64_t offset = static_cast<std::int64_t>(actionTime) - signalEpoch;
+        return (offset <= longPast) ? longPast : (offset > INT16_MAX) ? INT16_MAX : static_cast<std::int16_t>(offset);
+    }
+
+    inline std::int32_t actionTime(const signal::Signal& signal)
+    {
+        return (signal.epochTime == longPast) ? INT32_MIN : signalEpoch + signal.epochTime;
+    }
+
+    inline void rebaseSignals(std::int32_t epoch)
+    {
+        // every slot moves to the new epoch; longPast stays longPast whichever way the epoch moves
+        const std::int32_t oldEpoch = signalEpoch;
+        signalEpoch = epoch;
+        for (signal::Signal& signal : m_srb)
+        {
+            if (signal.epochTime != longPast)
+            {
+                signal.epochTime = toEpochTime(oldEpoch + signal.epochTime);
+            }
+        }
+    }
+
+    inline void followClock(std::int32_t clock)
+    {
+        // called serially before a tick, or before signals are written by hand
+        if (clock < signalEpoch || static_cast<std::int64_t>(clock) - signalEpoch >= epochSpan)
+        {
+            rebaseSignals(clock);
+        }
+    }
+
+    inline signal::Signal makeSignal(std::int32_t actionTime, std::int32_t sourceConnId, std::int16_t amplitude)
+    {
+        // a signal written outside the tick - the clock may have been set by hand
+        followClock(masterClock);
+        return signal::Signal{sourceConnId, toEpochTime(actionTime), amplitude};
+    }
+
+    inline std::int32_t testId(std::int32_t slot)
+    {
+        if constexpr (signalTestIds)
+        {
+            return m_srbTestIds[slot];
+        }
+        return 0;
+    }
+
+    /**
+     * Oct 2026: Signal handles.
+     * 
+     * Neuron queues hold a 32 bit handle rather than a bare srb slot number:
+     *      bits  0-23  slot number         - up to 16M srb slots
+     *      bits 24-31  generation          - the lap of the ring the slot was written in, mod 256
+     * 
+     * The generation is not stored anywhere. Slots are handed out in ring order, so a slot at or
+     * before the cursor was last written in the current lap (srbStats.wraps) and a slot after the
+     * cursor in the lap before. A handle is current when its generation matches that - one compare,
+     * no load from the signal. Once the cursor passes the slot again the handle is rejected exactly,
+     * even if the slot was reused for a signal to the same neuron - which the owner check could not
+     * catch. A handle still queued 256 laps later would alias - read as current again - and the
+     * budgeted purge sweep makes no promise to have dropped it by then. So every handleSweepLaps laps
+     * Neurons::dropStaleHandles clears every stale handle out of every queue, and a tick may emit at
+     * most handleSweepLaps laps of signals: no queued handle is ever more than 2 x handleSweepLaps
+     * laps old.
+     * 
+     * Handles made in the first lap have generation 0, so they equal the slot number.
+     */
+    using SignalHandle = std::int32_t;     // kept signed so queues stay int32 like every other index
+
+    inline constexpr std::int32_t handleSlotBits{24};
+    inline constexpr std::int32_t handleSlotMask{(1 << handleSlotBits) - 1};
+    inline constexpr std::int32_t maxSignalSlots{1 << handleSlotBits};
+    static_assert(maxSignalSlots == tcnconstants::max_signal_slots, "TCNConstants sizes the TCN against the handle's slot bits");
+    inline constexpr std::int64_t handleSweepLaps{64};     // laps between sweeps of stale handles, well under 256 / 2
+
+    inline std::uint32_t slotGeneration(std::int32_t slot)
+    {
+        // lap the slot was last written in
+        return static_cast<std::uint32_t>(srbStats.wraps - (slot > currentSignalSlot ? 1 : 0)) & 0xFFu;
+    }
+
+    inline SignalHandle makeHandle(std::int32_t slot)
+    {
+        return static_cast<SignalHandle>((slotGeneration(slot) << handleSlotBits) | static_cast<std::uint32_t>(slot));
+    }
+
+    inline std::int32_t handleSlot(SignalHandle handle)
+    {
+        return handle & handleSlotMask;
+    }
+
+    inline bool isCurrent(SignalHandle handle)
+    {
+        return (static_cast<std::uint32_t>(handle) >> handleSlotBits) == slotGeneration(handleSlot(handle));
+    }
+
+    inline std::int32_t handleActionTime(SignalHandle handle)
+    {
+        // stale handles read as INT32_MIN - long past. A handle goes stale wherever it sits in its
+        // queue, so only the current handles of a queue are in actionTime order: the queue searches
+        // step over stale ones rather than compare them.
+        return isCurrent(handle) ? actionTime(m_srb[handleSlot(handle)]) : INT32_MIN;
+    }
+
+    inline std::int32_t handleQueueKey(SignalHandle handle)
+    {
+        // insert_sorted key: a stale handle reads INT32_MAX so the walk back from the tail passes it
+        return isCurrent(handle) ? actionTime(m_srb[handleSlot(handle)]) : INT32_MAX;
+    }
+ 
+    /**
+     * Oct 2026: A run of consecutive ring slots reserved in one step by SignalRingBuffer::reserveSlots,
+     * so a worker thread can hand them out without touching the shared cursor.
+     * 
+     * take() walks the run exactly the way allocateSignalSlot walks the ring - including the wrap back
+     * to slot 0 and the live slot check - and keeps the lap it is in so handle() gives the same handle
+     * allocateSignalSlot + makeHandle would have. Live overwrites are counted in the block and added
+     * to srbStats by commitSlots.
+     */
+    struct SlotBlock {
+        std::int32_t next{0};               // slot take() hands out next
+        std::int64_t lap{0};                // srbStats.wraps while next is being written
+        std::int64_t takenLap{0};           // lap of the slot take() last handed out
+        std::int32_t remaining{0};          // slots left in the block
+        std::int64_t liveOverwrites{0};     // found by take(), not yet in srbStats
+
+        std::int32_t take()
+        {
+            std::int32_t slot = next;
+            if (actionTime(m_srb[slot]) > masterClock - tcnconstants::aggregation_window_ticks) {
+                if (srbWrapPolicy == WrapPolicy::FailFast) {
+                    throw std::length_error("SignalRingBuffer: slot " + std::to_string(slot) +
+                                            " is still live at masterClock " + std::to_string(masterClock));
+                }
+                ++liveOverwrites;
+            }
+            --remaining;
+            takenLap = lap;
+            if (++next >= signalBufferCapacity) {
+                next = 0;
+                ++lap;
+            }
+            return slot;
+        }
+
+        SignalHandle handle(std::int32_t slot) const
+        {
+            // handle for the slot take() just handed out
+            return static_cast<SignalHandle>((static_cast<std::uint32_t>(takenLap & 0xFF) << handleSlotBits) |
+                                             static_cast<std::uint32_t>(slot));
+        }
+    };
+ }
 
  namespace srb
  {
@@ -48,27 +279,33 @@ std::vector<signal::Signal> m_srb{};       // this remains a vector of the actua
         SignalRingBuffer (std::int32_t ringSize) 
         {
             #ifdef TESTING_MODE
-            // just reserve 30000 srb slots
-                m_srb.reserve(30000);
-            #else
-                m_srb.reserve(ringSize);
+            // just 30000 srb slots
+                ringSize = 30000;
             #endif 
 
-            signalBufferCapacity = m_srb.capacity();
+            currentSignalSlot = 0;
+            srbStats = RingStats{};
 
             // init m_srb with empty signals to allocate heap
             // regardless of size
             // create an empty signal with impossible clock value -ve always less then masterClock which starts @0
             // create impossible sourceConnId - new for STP/LTP group strengthening
             // impossible owner too...
+            // Oct 2026: one bulk fill of a fresh vector, so a second ring (or one after Grow) is sized afresh
+
+            // Oct 2026: the impossible clock value is srb::longPast - it reads back as INT32_MIN
 
-            signal::Signal emptySignal{ INT32_MIN,INT32_MIN,INT32_MIN, 1000,0}; // default values 
+            signal::Signal emptySignal{ INT32_MIN, longPast, 1000}; // default values 
+            pools::fill(m_srb, static_cast<std::size_t>(ringSize), emptySignal);
+            signalBufferCapacity = static_cast<std::int32_t>(m_srb.size());
+            signalEpoch = masterClock;
 
-            for (int i = 0; i < m_srb.capacity(); ++i) {
-                #ifdef TESTING_MODE
-                    emptySignal.testId = i;
-                #endif
-                m_srb.push_back(emptySignal);
+            m_srbTestIds.clear();
+            if constexpr (signalTestIds) {
+                m_srbTestIds.resize(m_srb.size());
+                for (int i = 0; i < signalBufferCapacity; ++i) {
+                    m_srbTestIds[i] = i;
+                }
             }
         }
 
@@ -81,29 +318,29 @@ std::vector<signal::Signal> m_srb{};       // this remains a vector of the actua
 
         std::int32_t getCurrentSignalSlot() { return currentSignalSlot; }
         signal::Signal getSlotRef(int slot) { return m_srb[currentSignalSlot]; }
+        std::int32_t getSlotTestId(int slot) { return testId(slot); }
 
+        // Oct 2026: the owner is the source connection's target - Connections::signalOwner
         void printSignalFromIndex(int32_t sidx)
         {
             std::cout << "\nSignal Index:= " << std::to_string(sidx);
-            std::cout << "\nactionTime:= " << std::to_string(m_srb[sidx].actionTime);
-            std::cout << "\nowner:= " << std::to_string(m_srb[sidx].owner);
+            std::cout << "\nactionTime:= " << std::to_string(actionTime(m_srb[sidx]));
+            std::cout << "\nsourceConnId:= " << std::to_string(m_srb[sidx].sourceConnId);
             std::cout << "\namplitude:= " << std::to_string(m_srb[sidx].amplitude);
-            std::cout << "\ntestId:= " << std::to_string(m_srb[sidx].testId) << '\n';
+            std::cout << "\ntestId:= " << std::to_string(testId(sidx)) << '\n';
         }
 
         void printSignalFromRef(signal::Signal& signalRef)
         {
-            std::cout << "Signal: actionTime:= " << std::to_string(signalRef.actionTime) << std::endl;
-            std::cout << "owner: = " << std::to_string(signalRef.owner) 
+            std::cout << "Signal: actionTime:= " << std::to_string(actionTime(signalRef)) << std::endl;
+            std::cout << "sourceConnId: = " << std::to_string(signalRef.sourceConnId) 
                 << " amplitude:= " << std::to_string(signalRef.amplitude) << std::endl; 
-            std::cout << "testId:= " << std::to_string(signalRef.testId) << std::endl;
         }
         void printSignalFromPointer(signal::Signal* signalPtr)
         {
-            std::cout << "\nSignal: actionTime:= " << std::to_string(signalPtr->actionTime);
-            std::cout << "\nowner:= " << std::to_string(signalPtr->owner);
+            std::cout << "\nSignal: actionTime:= " << std::to_string(actionTime(*signalPtr));
+            std::cout << "\nsourceConnId:= " << std::to_string(signalPtr->sourceConnId);
             std::cout << "\namplitude:= " << std::to_string(signalPtr->amplitude);
-            std::cout << "\ntestId:= " << std::to_string(signalPtr->testId);
             std::cout << std::endl;
         }
 
@@ -134,11 +371,16 @@ std::vector<signal::Signal> m_srb{};       // this remains a vector of the actua
          * on how many times we wrapped; used for future tuning of the srb
          * capacity.
          * 
+         * Oct 2026: Done. The ring tracks the oldest slot that may still be live (see isLive) and
+         * counts wraps and live-slot overwrites in srbStats. srbWrapPolicy decides what happens
+         * when the cursor catches up with a live slot. Also fixes the last slot: the old test
+         * could hand out slot signalBufferCapacity, one past the end of m_srb.
+         * 
          * @param   None
          * 
          * @return  The signal slot number for the next to be used.
          * 
-         * @throws  Nothing
+         * @throws  std::length_error when srbWrapPolicy is FailFast and the slot is still live
          */
 
          /**
@@ -154,15 +396,142 @@ std::vector<signal::Signal> m_srb{};       // this remains a vector of the actua
           * 
           */
         {
-            if (currentSignalSlot < signalBufferCapacity) {
-                // this will be the most frequent path
-                return ++currentSignalSlot;
+            std::int32_t slot = currentSignalSlot + 1;
+            if (slot >= signalBufferCapacity) {
+                // end of the ring - Grow may append rather than wrap
+                if (srbWrapPolicy == WrapPolicy::Grow && shouldGrow()) {
+                    grow();
+                }
+                else {
+                    slot = 0;
+                    ++srbStats.wraps;
+                }
+            }
+
+            if (isLive(slot)) {
+                if (srbWrapPolicy == WrapPolicy::FailFast) {
+                    throw std::length_error("SignalRingBuffer: slot " + std::to_string(slot) +
+                                            " is still live at masterClock " + std::to_string(masterClock));
+                }
+                ++srbStats.liveOverwrites;
             }
-            else {
-                // srb has wrapped
-                currentSignalSlot = 0;
-                return currentSignalSlot;
+
+            currentSignalSlot = slot;
+            ++srbStats.allocations;
+            trackOldestLive();
+            return slot;
+        }
+
+        SlotBlock reserveSlots(std::int32_t count)
+        /**
+         * @brief Move the cursor on by count slots in one step and return them as a SlotBlock.
+         * 
+         * @details Oct 2026: for the parallel tick. Reservations are made one after another at the
+         * tick barrier, in neuron order, so every engine gets the same slots; the blocks are then
+         * filled in parallel and commitSlots() finishes the bookkeeping. Callers must not reserve
+         * more than signalBufferCapacity slots between commits (blocks would overlap) and must use
+         * allocateSignalSlot under the Grow policy, which decides slot by slot at the end of the ring.
+         */
+        {
+            SlotBlock block;
+            std::int64_t first = static_cast<std::int64_t>(currentSignalSlot) + 1;
+            block.lap = srbStats.wraps;
+            if (first >= signalBufferCapacity) {
+                first = 0;
+                ++block.lap;
+            }
+            block.next = static_cast<std::int32_t>(first);
+            block.remaining = count;
+
+            if (count > 0) {
+                std::int64_t last = static_cast<std::int64_t>(currentSignalSlot) + count;
+                srbStats.wraps += last / signalBufferCapacity;
+                currentSignalSlot = static_cast<std::int32_t>(last % signalBufferCapacity);
+                srbStats.allocations += count;
+            }
+            return block;
+        }
+
+        void commitSlots(std::int64_t liveOverwrites)
+        {
+            // after the reserved blocks have been filled: the same stats allocateSignalSlot keeps
+            srbStats.liveOverwrites += liveOverwrites;
+            trackOldestLive();
+        }
+
+        static bool isLive(std::int32_t slot)
+        /**
+         * @brief A slot is live while its signal can still be read: it is due in the future or is
+         * still inside the aggregation window. Never-used slots carry INT32_MIN and are not live.
+         */
+        {
+            return actionTime(m_srb[slot]) > masterClock - tcnconstants::aggregation_window_ticks;
+        }
+
+        const RingStats& stats() const { return srbStats; }
+
+        std::int32_t suggestedCapacity() const
+        {
+            // live window high-water plus a quarter for headroom - what signal_count should be
+            std::int64_t suggested = static_cast<std::int64_t>(srbStats.liveWindowHighWater) * 5 / 4 + 1;
+            return static_cast<std::int32_t>(suggested < INT32_MAX ? suggested : INT32_MAX);
+        }
+
+        void printStats() const
+        {
+            std::cout << "\nSignal ring buffer:";
+            std::cout << "\n  capacity:= " << signalBufferCapacity
+                      << "  allocations:= " << srbStats.allocations
+                      << "  wraps:= " << srbStats.wraps
+                      << "  grows:= " << srbStats.grows;
+            std::cout << "\n  live overwrites:= " << srbStats.liveOverwrites
+                      << "  oldest live slot:= " << srbStats.oldestLiveSlot
+                      << "  live window:= " << srbStats.liveWindow
+                      << "  high-water:= " << srbStats.liveWindowHighWater
+                      << "  suggested capacity:= " << suggestedCapacity() << '\n';
+        }
+
+        private:
+
+        static void trackOldestLive()
+        {
+            // The oldest live slot chases the cursor; it stops at the first slot still live so the
+            // window is conservative when a long temporal distance signal is outstanding.
+            // Each slot is stepped over at most once per lap so this is O(1) amortized.
+            std::int32_t& oldest = srbStats.oldestLiveSlot;
+            while (oldest != currentSignalSlot && !isLive(oldest))
+            {
+                oldest = (oldest + 1 < signalBufferCapacity) ? oldest + 1 : 0;
+            }
+            std::int32_t window = currentSignalSlot - oldest + 1;
+            srbStats.liveWindow = (window > 0) ? window : window + signalBufferCapacity;
+            srbStats.liveWindowHighWater = (srbStats.liveWindow > srbStats.liveWindowHighWater) ?
+                                                srbStats.liveWindow : srbStats.liveWindowHighWater;
+        }
+
+        static bool shouldGrow()
+        {
+            // the cursor is at the end of the ring, so the live window runs from oldestLiveSlot to here
+            return signalBufferCapacity < maxSignalSlots &&      // handles only have room for this many
+                   static_cast<std::int64_t>(srbStats.liveWindow) * 100 >=
+                   static_cast<std::int64_t>(signalBufferCapacity) * growThresholdPercent;
+        }
+
+        static void grow()
+        {
+            // Append rather than insert so every slot index held by a neuron queue stays valid.
+            // The next slot handed out is the first new one.
+            signal::Signal emptySignal{ INT32_MIN, longPast, 1000};
+            std::int64_t newCapacity = static_cast<std::int64_t>(signalBufferCapacity) * 2;
+            newCapacity = (newCapacity < maxSignalSlots) ? newCapacity : maxSignalSlots;
+            m_srb.resize(static_cast<std::size_t>(newCapacity), emptySignal);
+            if constexpr (signalTestIds) {
+                for (std::int64_t i = signalBufferCapacity; i < newCapacity; ++i) {
+                    m_srbTestIds.push_back(static_cast<std::int32_t>(i));
+                }
             }
+            signalBufferCapacity = static_cast<std::int32_t>(newCapacity);
+            ++srbStats.grows;
         }
 
 
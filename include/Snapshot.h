@@ -0,0 +1,536 @@
+#ifndef SNAPSHOT_H_INCLUDED
+#define SNAPSHOT_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "TCNConstants.h"
+#include "Signal.h"
+#include "Connection.h"
+#include "Neuron.h"
+#include "SignalRingBuffer.h"
+#include "EventWheel.h"
+#include "TickPartitions.h"
+#include "WorkerPool.h"
+
+extern neuron::NeuronPool m_neuronPool;
+extern std::int32_t currentNeuronSlot;
+extern std::int32_t neuronPoolCapacity;
+extern std::int32_t globalNextEvent;
+extern std::int32_t masterClock;
+extern std::int32_t youngestSignal;
+extern std::vector<connection::Connection> m_connPool;
+extern std::int32_t currentConnectionSlot;
+extern std::int32_t connectionPoolCapacity;
+extern std::vector<connection::HotConnection> m_connHot;
+extern std::vector<connection::ColdConnection> m_connCold;
+extern bool connPoolPacked;
+extern workers::WorkerPool tickWorkers;
+extern tick::TickPartitions tickPartitions;
+
+/**
+ * @brief Snapshot
+ *
+ * Versioned binary image of a built TCN - topology and live state - that is mapped back in
+ * rather than rebuilt.
+ *
+ * @details Oct 2026: Every run used to rebuild m_neuronPool, m_connPool and m_srb from scratch.
+ * save() writes the live network to one file:
+ *    Header            magic, version, the sizes of the structs it holds, counts, clocks, srb cursor
+ *                      and stats, and a table of sections
+ *    sections          one raw array each, every one aligned to sectionAlignment so it can be used
+ *                      straight out of the mapping
+ *        NextEvent, RefractoryEnd              int32 per neuron
+ *        OutgoingOffsets, OutgoingSignals      the CSR fan-out as it is in the neuron pool
+ *        Connections                           m_connPool - weights and lastSignalOriginTime included
+ *        HotConnections, ColdConnections       the packed pool instead, when it is the live one
+ *        Signals                               m_srb, every slot
+ *        QueueOffsets, QueueHandles            the incoming queues as a CSR of srb::SignalHandle
+ *        ActiveNeurons                         the active set's members, in set order
+ *
+ * MappedSnapshot maps a file read only and hands out const views of the sections in place, so a
+ * snapshot can be inspected, or forked into many experiments, without reading it. restore() makes
+ * it the live network: the pools are still vectors, so each array is one bulk copy out of the
+ * mapping, with no per element construction. The queues are pushed back into the signal arena
+ * and the event wheel is rescheduled from nextEvent; both are derived state and are not saved.
+ * Handles stay valid because the srb cursor and wrap count are restored with the ring.
+ *
+ * The format is the in-memory layout, so a snapshot only loads on a build with the same struct
+ * sizes and byte order; the header records both and restore refuses anything else.
+ */
+
+namespace snapshot
+{
+    inline constexpr std::uint64_t magic{0x50414E534E4354ULL};     // "TCNSNAP" little endian
+    inline constexpr std::uint32_t formatVersion{6};      // 2: packed connection pool sections, 3: 8 byte signals, 4: purge cursor, 5: active set, 6: handle sweep lap
+    inline constexpr std::uint32_t byteOrderMark{0x01020304};
+    inline constexpr std::uint64_t sectionAlignment{64};
+
+    enum class Section : std::uint32_t {
+        NextEvent = 0,
+        RefractoryEnd,
+        OutgoingOffsets,
+        OutgoingSignals,
+        Connections,
+        Signals,
+        QueueOffsets,
+        QueueHandles,
+        HotConnections,
+        ColdConnections,
+        ActiveNeurons,
+        Count
+    };
+
+    inline constexpr std::uint32_t sectionCount{static_cast<std::uint32_t>(Section::Count)};
+
+    struct SectionEntry {
+        std::uint64_t offset;       // from the start of the file, a multiple of sectionAlignment
+        std::uint64_t bytes;
+    };
+
+    struct Header {
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t connectionSize;           // sizeof(connection::Connection)
+        std::uint32_t signalSize;               // sizeof(signal::Signal)
+        std::uint32_t ringStatsSize;            // sizeof(srb::RingStats)
+        std::uint32_t hotConnectionSize;        // sizeof(connection::HotConnection)
+        std::uint32_t coldConnectionSize;       // sizeof(connection::ColdConnection)
+        std::int32_t neuronCount;
+        std::int32_t connectionCount;           // connections in whichever pool is live
+        std::int32_t packedConnections;         // 1 if that is m_connHot/m_connCold
+        std::int32_t signalCount;               // m_srb.size()
+        std::int64_t queuedSignals;             // handles in every incoming queue
+        std::int64_t fanOutEntries;             // outgoingSignals.size()
+        std::int32_t activeNeurons;             // members of the active set
+        std::int32_t masterClock;
+        std::int32_t wheelClock;
+        std::int32_t youngestSignal;
+        std::int32_t purgeCursor;               // where the purge sweep carries on
+        std::int32_t currentNeuronSlot;
+        std::int32_t currentConnectionSlot;
+        std::int32_t currentSignalSlot;
+        std::int32_t signalEpoch;               // the signals' epochTime is relative to this
+        std::int32_t wrapPolicy;                // srb::WrapPolicy
+        std::int32_t partitionAlignment;        // tick partitions are rebuilt on this boundary
+        srb::RingStats srbStats;
+        SectionEntry sections[sectionCount];
+    };
+
+    template <typename T>
+    struct View {
+        const T* data;
+        std::size_t size;
+        const T* begin() const { return data; }
+        const T* end() const { return data + size; }
+        const T& operator[](std::size_t idx) const { return data[idx]; }
+    };
+
+    inline std::uint64_t aligned(std::uint64_t offset)
+    {
+        return (offset + sectionAlignment - 1) & ~(sectionAlignment - 1);
+    }
+
+    inline std::int64_t save(const std::string& path)
+    {
+        /**
+         * @brief Write the live network to path.
+         *
+         * @return  bytes written
+         *
+         * @throws  std::runtime_error if the file cannot be written
+         */
+        m_neuronPool.buildOutgoingIndex();      // staged connections would not survive otherwise
+
+        const std::int32_t neuronCount = m_neuronPool.size();
+        std::vector<std::int64_t> queueOffsets(static_cast<std::size_t>(neuronCount) + 1, 0);
+        for (std::int32_t n = 0; n < neuronCount; ++n)
+        {
+            queueOffsets[n + 1] = queueOffsets[n] + m_neuronPool.incomingSignals.header(n).size;
+        }
+
+        Header header{};
+        header.magic = magic;
+        header.version = formatVersion;
+        header.byteOrder = byteOrderMark;
+        header.connectionSize = sizeof(connection::Connection);
+        header.signalSize = sizeof(signal::Signal);
+        header.ringStatsSize = sizeof(srb::RingStats);
+        header.hotConnectionSize = sizeof(connection::HotConnection);
+        header.coldConnectionSize = sizeof(connection::ColdConnection);
+        header.neuronCount = neuronCount;
+        header.connectionCount = static_cast<std::int32_t>(connPoolPacked ? m_connHot.size() : m_connPool.size());
+        header.packedConnections = connPoolPacked ? 1 : 0;
+        header.signalCount = static_cast<std::int32_t>(m_srb.size());
+        header.queuedSignals = queueOffsets[neuronCount];
+        header.fanOutEntries = static_cast<std::int64_t>(m_neuronPool.outgoingSignals.size());
+        header.activeNeurons = m_neuronPool.activeNeurons.size();
+        header.masterClock = masterClock;
+        header.wheelClock = eventWheel.wheelClock();
+        header.youngestSignal = youngestSignal;
+        header.purgeCursor = m_neuronPool.purgeCursor;
+        header.currentNeuronSlot = currentNeuronSlot;
+        header.currentConnectionSlot = currentConnectionSlot;
+        header.currentSignalSlot = currentSignalSlot;
+        header.signalEpoch = signalEpoch;
+        header.wrapPolicy = static_cast<std::int32_t>(srbWrapPolicy);
+        header.partitionAlignment = tickPartitions.alignment();
+        header.srbStats = srbStats;
+
+        const std::uint64_t bytes[sectionCount] = {
+            static_cast<std::uint64_t>(neuronCount) * sizeof(std::int32_t),
+            static_cast<std::uint64_t>(neuronCount) * sizeof(std::int32_t),
+            m_neuronPool.outgoingOffsets.size() * sizeof(std::int32_t),
+            m_neuronPool.outgoingSignals.size() * sizeof(std::int32_t),
+            m_connPool.size() * sizeof(connection::Connection),
+            m_srb.size() * sizeof(signal::Signal),
+            queueOffsets.size() * sizeof(std::int64_t),
+            static_cast<std::uint64_t>(header.queuedSignals) * sizeof(srb::SignalHandle),
+            m_connHot.size() * sizeof(connection::HotConnection),
+            m_connCold.size() * sizeof(connection::ColdConnection),
+            static_cast<std::uint64_t>(header.activeNeurons) * sizeof(std::int32_t)
+        };
+        std::uint64_t offset = aligned(sizeof(Header));
+        for (std::uint32_t s = 0; s < sectionCount; ++s)
+        {
+            header.sections[s] = SectionEntry{offset, bytes[s]};
+            offset = aligned(offset + bytes[s]);
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            throw std::runtime_error("snapshot: cannot open " + path + " for writing");
+        }
+        std::uint64_t written{0};
+        auto put = [&out, &written](const void* data, std::uint64_t count)
+        {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(count));
+            written += count;
+        };
+        auto padTo = [&put, &written](std::uint64_t target)
+        {
+            static const char zeros[sectionAlignment]{};
+            while (written < target)
+            {
+                std::uint64_t gap = target - written;
+                put(zeros, gap < sectionAlignment ? gap : sectionAlignment);
+            }
+        };
+
+        put(&header, sizeof(Header));
+        const void* arrays[sectionCount] = {
+            m_neuronPool.nextEvent.data(), m_neuronPool.refractoryEnd.data(),
+            m_neuronPool.outgoingOffsets.data(), m_neuronPool.outgoingSignals.data(),
+            m_connPool.data(), m_srb.data(), queueOffsets.data(), nullptr,
+            m_connHot.data(), m_connCold.data(), m_neuronPool.activeNeurons.begin()
+        };
+        for (std::uint32_t s = 0; s < sectionCount; ++s)
+        {
+            padTo(header.sections[s].offset);
+            if (static_cast<Section>(s) == Section::QueueHandles)
+            {
+                // straight out of the arena, queue by queue
+                for (std::int32_t n = 0; n < neuronCount; ++n)
+                {
+                    put(m_neuronPool.incomingSignals.data(n),
+                        static_cast<std::uint64_t>(m_neuronPool.incomingSignals.header(n).size) * sizeof(srb::SignalHandle));
+                }
+            }
+            else if (header.sections[s].bytes != 0)
+            {
+                put(arrays[s], header.sections[s].bytes);
+            }
+        }
+        padTo(offset);
+        out.flush();
+        if (!out)
+        {
+            throw std::runtime_error("snapshot: writing " + path + " failed");
+        }
+        return static_cast<std::int64_t>(written);
+    }
+
+    class MappedSnapshot
+    /**
+     * @brief A snapshot file mapped read only. Views point into the mapping and stay valid for the
+     * life of the object; pages are only read when they are touched.
+     */
+    {
+        public:
+
+        explicit MappedSnapshot(const std::string& path)
+        /**
+         * @throws  std::runtime_error if the file cannot be mapped
+         * @throws  std::invalid_argument if it is not a snapshot this build can use
+         */
+        {
+            map(path);
+            try
+            {
+                validate(path);
+            }
+            catch (...)
+            {
+                unmap();
+                throw;
+            }
+        }
+
+        MappedSnapshot(const MappedSnapshot&) = delete;
+        MappedSnapshot& operator=(const MappedSnapshot&) = delete;
+
+        ~MappedSnapshot()
+        {
+            unmap();
+        }
+
+        const Header& header() const { return *reinterpret_cast<const Header*>(m_base); }
+        std::uint64_t bytes() const { return m_bytes; }
+
+        template <typename T>
+        View<T> section(Section s) const
+        {
+            const SectionEntry& entry = header().sections[static_cast<std::uint32_t>(s)];
+            return View<T>{reinterpret_cast<const T*>(m_base + entry.offset), static_cast<std::size_t>(entry.bytes / sizeof(T))};
+        }
+
+        View<std::int32_t> nextEvent() const { return section<std::int32_t>(Section::NextEvent); }
+        View<std::int32_t> refractoryEnd() const { return section<std::int32_t>(Section::RefractoryEnd); }
+        View<std::int32_t> outgoingOffsets() const { return section<std::int32_t>(Section::OutgoingOffsets); }
+        View<std::int32_t> outgoingSignals() const { return section<std::int32_t>(Section::OutgoingSignals); }
+        View<connection::Connection> connections() const { return section<connection::Connection>(Section::Connections); }
+        View<signal::Signal> signals() const { return section<signal::Signal>(Section::Signals); }
+        View<std::int64_t> queueOffsets() const { return section<std::int64_t>(Section::QueueOffsets); }
+        View<srb::SignalHandle> queueHandles() const { return section<srb::SignalHandle>(Section::QueueHandles); }
+        View<connection::HotConnection> hotConnections() const { return section<connection::HotConnection>(Section::HotConnections); }
+        View<connection::ColdConnection> coldConnections() const { return section<connection::ColdConnection>(Section::ColdConnections); }
+        View<std::int32_t> activeNeurons() const { return section<std::int32_t>(Section::ActiveNeurons); }
+
+        private:
+
+        const char* m_base{nullptr};
+        std::uint64_t m_bytes{0};
+        #if defined(_WIN32)
+        HANDLE m_file{INVALID_HANDLE_VALUE};
+        HANDLE m_mapping{nullptr};
+        #endif
+
+        void map(const std::string& path)
+        {
+            #if defined(_WIN32)
+            m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, nullptr);
+            LARGE_INTEGER size{};
+            if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+            {
+                unmap();
+                throw std::runtime_error("snapshot: cannot open " + path);
+            }
+            m_bytes = static_cast<std::uint64_t>(size.QuadPart);
+            m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            m_base = m_mapping ? static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+            if (m_base == nullptr)
+            {
+                unmap();
+                throw std::runtime_error("snapshot: cannot map " + path);
+            }
+            #else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            struct stat info{};
+            if (fd < 0 || ::fstat(fd, &info) != 0 || info.st_size == 0)
+            {
+                if (fd >= 0) { ::close(fd); }
+                throw std::runtime_error("snapshot: cannot open " + path);
+            }
+            m_bytes = static_cast<std::uint64_t>(info.st_size);
+            void* base = ::mmap(nullptr, static_cast<std::size_t>(m_bytes), PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);        // the mapping keeps the file
+            if (base == MAP_FAILED)
+            {
+                m_bytes = 0;
+                throw std::runtime_error("snapshot: cannot map " + path);
+            }
+            m_base = static_cast<const char*>(base);
+            #endif
+        }
+
+        void unmap()
+        {
+            #if defined(_WIN32)
+            if (m_base) { UnmapViewOfFile(m_base); }
+            if (m_mapping) { CloseHandle(m_mapping); }
+            if (m_file != INVALID_HANDLE_VALUE) { CloseHandle(m_file); }
+            m_mapping = nullptr;
+            m_file = INVALID_HANDLE_VALUE;
+            #else
+            if (m_base) { ::munmap(const_cast<char*>(m_base), static_cast<std::size_t>(m_bytes)); }
+            #endif
+            m_base = nullptr;
+            m_bytes = 0;
+        }
+
+        void validate(const std::string& path) const
+        {
+            if (m_bytes < sizeof(Header))
+            {
+                throw std::invalid_argument("snapshot: " + path + " is too short for a header");
+            }
+            const Header& h = header();
+            if (h.magic != magic)
+            {
+                throw std::invalid_argument("snapshot: " + path + " is not a TCN snapshot");
+            }
+            if (h.version != formatVersion)
+            {
+                throw std::invalid_argument("snapshot: " + path + " is format version " + std::to_string(h.version) +
+                                            ", this build reads " + std::to_string(formatVersion));
+            }
+            if (h.byteOrder != byteOrderMark || h.connectionSize != sizeof(connection::Connection) ||
+                h.signalSize != sizeof(signal::Signal) || h.ringStatsSize != sizeof(srb::RingStats) ||
+                h.hotConnectionSize != sizeof(connection::HotConnection) ||
+                h.coldConnectionSize != sizeof(connection::ColdConnection))
+            {
+                throw std::invalid_argument("snapshot: " + path + " was written by a build with a different layout");
+            }
+
+            // every section inside the file and the size its counts say it is
+            const std::uint64_t neurons = static_cast<std::uint64_t>(h.neuronCount);
+            const std::uint64_t full = (h.packedConnections != 0) ? 0 : static_cast<std::uint64_t>(h.connectionCount);
+            const std::uint64_t packed = (h.packedConnections != 0) ? static_cast<std::uint64_t>(h.connectionCount) : 0;
+            const std::uint64_t expected[sectionCount] = {
+                neurons * sizeof(std::int32_t),
+                neurons * sizeof(std::int32_t),
+                (neurons + 1) * sizeof(std::int32_t),
+                static_cast<std::uint64_t>(h.fanOutEntries) * sizeof(std::int32_t),
+                full * sizeof(connection::Connection),
+                static_cast<std::uint64_t>(h.signalCount) * sizeof(signal::Signal),
+                (neurons + 1) * sizeof(std::int64_t),
+                static_cast<std::uint64_t>(h.queuedSignals) * sizeof(srb::SignalHandle),
+                packed * sizeof(connection::HotConnection),
+                packed * sizeof(connection::ColdConnection),
+                static_cast<std::uint64_t>(h.activeNeurons) * sizeof(std::int32_t)
+            };
+            for (std::uint32_t s = 0; s < sectionCount; ++s)
+            {
+                const SectionEntry& entry = h.sections[s];
+                if (entry.bytes != expected[s] || entry.offset % sectionAlignment != 0 ||
+                    entry.offset > m_bytes || entry.bytes > m_bytes - entry.offset)
+                {
+                    throw std::invalid_argument("snapshot: " + path + " section " + std::to_string(s) + " is corrupt");
+                }
+            }
+        }
+    };
+
+    template <typename T>
+    void assign(std::vector<T>& pool, const View<T>& view)
+    {
+        // one bulk copy out of the mapping - T is a plain struct or an int
+        pool.resize(view.size);
+        if (view.size != 0)
+        {
+            std::memcpy(pool.data(), view.data, view.size * sizeof(T));
+        }
+    }
+
+    inline void restore(const MappedSnapshot& image)
+    {
+        /**
+         * @brief Make the snapshot the live network, replacing whatever is in the globals.
+         *
+         * @details The tick partitions are rebuilt for the current tickWorkers on the alignment the
+         * snapshot was taken with; the result of a tick does not depend on either.
+         */
+        const Header& h = image.header();
+
+        assign(m_neuronPool.nextEvent, image.nextEvent());
+        assign(m_neuronPool.refractoryEnd, image.refractoryEnd());
+        assign(m_neuronPool.outgoingOffsets, image.outgoingOffsets());
+        assign(m_neuronPool.outgoingSignals, image.outgoingSignals());
+        std::vector<std::pair<std::int32_t, std::int32_t>>().swap(m_neuronPool.pendingOutgoing);
+        currentNeuronSlot = h.currentNeuronSlot;
+        neuronPoolCapacity = h.neuronCount;
+
+        assign(m_connPool, image.connections());
+        assign(m_connHot, image.hotConnections());
+        assign(m_connCold, image.coldConnections());
+        connPoolPacked = h.packedConnections != 0;
+        currentConnectionSlot = h.currentConnectionSlot;
+        connectionPoolCapacity = h.connectionCount;
+
+        assign(m_srb, image.signals());
+        signalBufferCapacity = h.signalCount;
+        currentSignalSlot = h.currentSignalSlot;
+        signalEpoch = h.signalEpoch;
+        m_srbTestIds.clear();
+        if constexpr (srb::signalTestIds)
+        {
+            // test ids are not saved - they are the slot numbers, as the ring constructor makes them
+            for (std::int32_t slot = 0; slot < h.signalCount; ++slot)
+            {
+                m_srbTestIds.push_back(slot);
+            }
+        }
+        srbStats = h.srbStats;
+        srbWrapPolicy = static_cast<srb::WrapPolicy>(h.wrapPolicy);
+
+        masterClock = h.masterClock;
+        youngestSignal = h.youngestSignal;
+        m_neuronPool.activeNeurons.resize(h.neuronCount);
+        for (std::int32_t neuronId : image.activeNeurons())
+        {
+            m_neuronPool.activeNeurons.insert(neuronId);
+        }
+        m_neuronPool.purgeCursor = h.purgeCursor;
+
+        // queues go into a freshly partitioned arena, already in actionTime order
+        tickPartitions.configure(h.neuronCount, tickWorkers.size(), h.partitionAlignment);
+        m_neuronPool.incomingSignals.resize(h.neuronCount);
+        m_neuronPool.incomingSignals.partition(tickPartitions.firstNeurons());
+        const View<std::int64_t> queueOffsets = image.queueOffsets();
+        const View<srb::SignalHandle> handles = image.queueHandles();
+        for (std::int32_t n = 0; n < h.neuronCount; ++n)
+        {
+            for (std::int64_t q = queueOffsets[n]; q < queueOffsets[n + 1]; ++q)
+            {
+                m_neuronPool.incomingSignals.push_back(n, handles[static_cast<std::size_t>(q)]);
+            }
+        }
+
+        // the wheel only ever needs each neuron's nextEvent - stale entries were never needed
+        eventWheel.reset(h.wheelClock);
+        for (std::int32_t n = 0; n < h.neuronCount; ++n)
+        {
+            if (m_neuronPool.nextEvent[n] != INT32_MAX)
+            {
+                eventWheel.schedule(n, m_neuronPool.nextEvent[n]);
+            }
+        }
+        globalNextEvent = eventWheel.nextEventTime();
+    }
+
+    inline void restore(const std::string& path)
+    {
+        MappedSnapshot image(path);
+        restore(image);
+    }
+
+}   // end snapshot namespace
+
+#endif // SNAPSHOT_H_INCLUDED
@@ -48,6 +48,9 @@ namespace tcnconstants
     // the following are guesstimates for the size of the TCN
     inline constexpr int32_t neuron_signal_ratio{10};                                  // average count of signals/neuron
     inline constexpr int32_t signal_count{neuron_count * neuron_signal_ratio};         // average of 10 per neuron
+    inline constexpr int32_t max_signal_slots{1 << 24};                                // srb handles carry a 24 bit slot
+    static_assert(signal_count <= max_signal_slots,
+                  "the srb is capped at 2^24 slots - at 10 signals a neuron a TCN tops out near 1.6M neurons");
     inline constexpr int32_t neuron_connection_ratio{50};                              // average count of connections per neuron
     inline constexpr int32_t connection_count{neuron_count * neuron_connection_ratio}; // thirty connections per neuron
 
@@ -63,6 +66,12 @@ namespace tcnconstants
     inline constexpr float V1_inhibition_ratio{0.4};
     inline constexpr float L6_inhibition_ratio{0.4};
 
+    // Oct 2026: temporal distances laid down by the network builders (netbuild namespace)
+    inline constexpr int32_t horizontal_distance{1};      // ticks between neurons in one SixPack layer
+    inline constexpr int32_t interconnect_distance{2};    // between adjacent layers of a SixPack
+    inline constexpr int32_t branched_distance{4};        // between a SixPack and its parent or child SixPacks
+    inline constexpr int32_t distance_jitter{3};          // 0 .. distance_jitter - 1 ticks added at random
+
     
     /**
      * July 2025
@@ -85,6 +94,8 @@ namespace tcnconstants
     inline constexpr int32_t refractoryWidth{5};     // refractory period width
     inline constexpr int32_t purgeThreshold{10};     // don't purge signals below purgeThreshold - perf.
     inline constexpr int32_t stalePurgeThreshold{25}; // used to undertake a purge for active neuron stale signals
+    inline constexpr int32_t purgeSweepNeurons{1024}; // Oct 2026: neurons the purge sweep visits each tick
+    inline constexpr int32_t purgeSweepBudget{4096};  // Oct 2026: most queue entries the purge sweep drops each tick
 
     inline constexpr int16_t cascadeThreshold{12000}; // value to cause neuron to cascade aka 12 mv.
     inline constexpr int32_t msecs_refractory_period{5};     // 5 msecs; 1 spike + 4 recovery
@@ -92,6 +103,7 @@ namespace tcnconstants
     inline constexpr int32_t aggregation_decay_factor{2};   // 1/32 after 5 msecs
     inline constexpr int32_t ticks_per_msec{1};     // millisec clock rate
                                                     // all msec measurements will use this scaling factor
+    inline constexpr int32_t aggregation_window_ticks{msecs_aggregation_window * ticks_per_msec};  // signals older than this never aggregate
     inline constexpr int32_t micro_col_size{5};     // size of neuron microcolums in sixpacks
     inline constexpr int32_t col_size{49};          // size of column array in sixpack layers
     inline constexpr int32_t layer_count{100};      // number of layers in a sixpack
@@ -129,6 +141,11 @@ namespace tcnconstants
     // each decay interval reduces ltp value by one unit - 1800 msecs
     inline constexpr   int16_t ltp_unit_decay_interval {ltp_decay_time / (ltp_signal_limit - base_signal_size)};
 
+    // Oct 2026: ltp grows only while stp is saturated - this many tetanic pulses to reach the limit
+    inline constexpr   int16_t ltp_tetanic_pulse_size {700};
+    inline constexpr   int16_t ltp_units_per_tetanic_pulse {(ltp_signal_limit - base_signal_size)/ltp_tetanic_pulse_size};   // 10
+    static_assert(ltp_units_per_tetanic_pulse > 0, "a tetanic pulse must grow ltp by at least one unit");
+
 
  
 
@@ -0,0 +1,101 @@
+#ifndef TCNSTATE_H_INCLUDED
+#define TCNSTATE_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+#include <vector>
+#include <utility>
+
+#include "Neurons.h"
+#include "Connections.h"
+#include "SignalRingBuffer.h"
+#include "EventWheel.h"
+#include "TickPartitions.h"
+
+/**
+ * @brief TCNState
+ *
+ * Everything one Temporal Connection Network needs to tick, held while the network is parked.
+ *
+ * @details Oct 2026: The tick engine works on the process globals - m_neuronPool, m_connPool,
+ * m_srb, eventWheel, masterClock and friends - which is what keeps the inner loops free of an
+ * extra indirection. To run several TCNs in one process each network keeps its own copy of that
+ * state here, and swapGlobals() exchanges it with the globals to make the network the live one.
+ * Every member is a vector or a plain value, so a swap is a handful of pointer exchanges however
+ * big the network is; nothing is copied. Parked networks cost memory only, no time. The
+ * price is that exactly one network is live at a time: the networks of a process run one after
+ * another (aTCNManager is a serial scheduler), never side by side.
+ *
+ * The tick worker threads (tickWorkers) are not per network - every TCN shares them.
+ * Default values match the globals' own, so a fresh TCNState swapped in is an empty network.
+ */
+
+namespace tcn
+{
+    struct TCNState {
+        // neuron pool and clocks - Neurons.h
+        neuron::NeuronPool neuronPool{};
+        std::int32_t currentNeuronSlot{-1};
+        std::int32_t neuronPoolCapacity{0};
+        std::int32_t globalNextEvent{INT32_MAX};    // next tick with work while parked
+        std::int32_t masterClock{0};
+        std::int32_t youngestSignal{0};
+        tick::TickPartitions partitions{};
+
+        // connection pool - Connections.h
+        std::vector<connection::Connection> connPool{};
+        std::int32_t currentConnectionSlot{0};      // netbuild hands out connection ids after it
+        std::int32_t connectionPoolCapacity{0};
+        std::vector<connection::HotConnection> connHot{};
+        std::vector<connection::ColdConnection> connCold{};
+        bool connPoolPacked{false};
+
+        // signal ring buffer - SignalRingBuffer.h
+        std::vector<signal::Signal> srb{};
+        std::vector<std::int32_t> srbTestIds{};
+        std::int32_t currentSignalSlot{0};
+        std::int32_t signalBufferCapacity{0};
+        std::int32_t signalEpoch{0};
+        srb::RingStats srbStats{};
+        srb::WrapPolicy srbWrapPolicy{srb::WrapPolicy::Overwrite};
+
+        // event wheel - EventWheel.h
+        wheel::EventWheel wheel{};
+
+        // scheduling, kept by the aTCNManager
+        std::int64_t ticks{0};          // ticks this network has processed
+        std::int64_t activations{0};    // times it was swapped in to do work
+
+        void swapGlobals()
+        {
+            // park the live network here and make this one live - calling it again undoes it
+            m_neuronPool.swap(neuronPool);
+            std::swap(::currentNeuronSlot, currentNeuronSlot);
+            std::swap(::neuronPoolCapacity, neuronPoolCapacity);
+            std::swap(::globalNextEvent, globalNextEvent);
+            std::swap(::masterClock, masterClock);
+            std::swap(::youngestSignal, youngestSignal);
+            std::swap(tickPartitions, partitions);
+
+            m_connPool.swap(connPool);
+            std::swap(::currentConnectionSlot, currentConnectionSlot);
+            std::swap(::connectionPoolCapacity, connectionPoolCapacity);
+            m_connHot.swap(connHot);
+            m_connCold.swap(connCold);
+            std::swap(::connPoolPacked, connPoolPacked);
+
+            m_srb.swap(srb);
+            m_srbTestIds.swap(srbTestIds);
+            std::swap(::currentSignalSlot, currentSignalSlot);
+            std::swap(::signalBufferCapacity, signalBufferCapacity);
+            std::swap(::signalEpoch, signalEpoch);
+            std::swap(::srbStats, srbStats);
+            std::swap(::srbWrapPolicy, srbWrapPolicy);
+
+            eventWheel.swap(wheel);
+        }
+    };
+
+}   // end tcn namespace
+
+#endif // TCNSTATE_H_INCLUDED
@@ -0,0 +1,241 @@
+#ifndef TCNTOPOLOGY_H_INCLUDED
+#define TCNTOPOLOGY_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+#include <array>
+#include <stdexcept>
+#include <string>
+
+#include "TCNConstants.h"
+#include "SignalRingBuffer.h"
+
+/**
+ * @brief TCNTopology
+ *
+ * Where every neuron of a TCN lives in the linear neuron pool: visual layer (IT, V4, V2, V1),
+ * SixPack within the layer, SixPack layer (L1 .. L6) and position in that layer.
+ *
+ * @details Oct 2026: The pool is laid out visual layer by visual layer, SixPack by SixPack and
+ * L1 to L6 inside a SixPack. Each visual layer has fanOut times the SixPacks of the one above,
+ * starting with fanOut SixPacks in IT - tcnconstants::IT, V4, V2, V1.
+ *
+ * TCNTopology<fanOut, SixPackShape<...>> works all of that out at compile time: layer origins,
+ * SixPack origins, pool sizes and neuronId / locate are constexpr, so index math with constant
+ * arguments folds away, pools can be std::array (PerNeuron, PerSixPack) and static_asserts stop a
+ * deployment that would overflow an int32 neuron id, a connection index or the srb handle's 24
+ * slot bits. DynamicTopology is the runtime fallback for configurable networks: the same names
+ * and the same arithmetic (topology::Layout), checked when it is constructed instead.
+ *
+ * The slot bits are the tightest limit: with neuron_signal_ratio 10 signals a neuron the ring's
+ * 2^24 slots (tcnconstants::max_signal_slots) cap a topology at about 1.6M neurons.
+ *
+ * Code written against either takes the topology as a template parameter and uses
+ * topology.neuronCount, topology.sixPackSize, topology.neuronId(...) - static members of
+ * TCNTopology read through an object just like DynamicTopology's.
+ */
+
+namespace topology
+{
+    enum class VLayer : std::int32_t { IT = 0, V4 = 1, V2 = 2, V1 = 3 };
+
+    inline constexpr std::int32_t vLayerCount{4};
+    inline constexpr std::int32_t packLayerCount{6};    // L1 .. L6, stored 0 .. 5
+
+    struct NeuronCoord {
+        VLayer vLayer;
+        std::int32_t sixPack;       // within the visual layer
+        std::int32_t packLayer;     // 0 = L1 .. 5 = L6
+        std::int32_t index;         // within the SixPack layer
+    };
+
+    struct Shape {
+        std::int32_t l1Width;
+        std::int32_t l1Depth;
+        std::int32_t lxWidth;       // L2 .. L6 are all the same size
+        std::int32_t lxDepth;
+
+        constexpr std::int32_t layerSize(std::int32_t packLayer) const
+        {
+            return (packLayer == 0) ? l1Width * l1Depth : lxWidth * lxDepth;
+        }
+
+        constexpr std::int32_t layerOffset(std::int32_t packLayer) const
+        {
+            return (packLayer == 0) ? 0 : l1Width * l1Depth + (packLayer - 1) * lxWidth * lxDepth;
+        }
+
+        constexpr std::int32_t size() const { return layerOffset(packLayerCount); }
+
+        constexpr std::int64_t size64() const
+        {
+            return std::int64_t{l1Width} * l1Depth + std::int64_t{packLayerCount - 1} * lxWidth * lxDepth;
+        }
+    };
+
+    struct Layout {
+        std::int32_t fanOut;
+        Shape shape;
+
+        constexpr std::int64_t sixPacksIn64(VLayer vLayer) const
+        {
+            // saturates just past INT32_MAX so no product below can overflow an int64
+            constexpr std::int64_t tooBig{std::int64_t{INT32_MAX} + 1};
+            std::int64_t count{1};
+            for (std::int32_t v = 0; v <= static_cast<std::int32_t>(vLayer); ++v)
+            {
+                count = (count * fanOut > tooBig) ? tooBig : count * fanOut;
+            }
+            return count;
+        }
+
+        constexpr std::int64_t sixPackCount64() const
+        {
+            return sixPacksIn64(VLayer::IT) + sixPacksIn64(VLayer::V4) + sixPacksIn64(VLayer::V2) + sixPacksIn64(VLayer::V1);
+        }
+
+        constexpr std::int64_t neuronCount64() const { return sixPackCount64() * shape.size64(); }
+
+        constexpr bool valid() const
+        {
+            // every count and id must fit the pools' int32 indices and the srb handle's slot bits
+            return fanOut > 0 && shape.l1Width > 0 && shape.l1Depth > 0 && shape.lxWidth > 0 && shape.lxDepth > 0 &&
+                   shape.size64() <= INT32_MAX && sixPackCount64() <= INT32_MAX && neuronCount64() <= INT32_MAX &&
+                   neuronCount64() * tcnconstants::neuron_connection_ratio <= INT32_MAX &&
+                   neuronCount64() * tcnconstants::neuron_signal_ratio <= srb::maxSignalSlots;
+        }
+
+        // everything below assumes valid()
+
+        constexpr std::int32_t sixPacksIn(VLayer vLayer) const { return static_cast<std::int32_t>(sixPacksIn64(vLayer)); }
+
+        constexpr std::int32_t vLayerSixPackOrigin(VLayer vLayer) const
+        {
+            std::int32_t origin{0};
+            for (std::int32_t v = 0; v < static_cast<std::int32_t>(vLayer); ++v)
+            {
+                origin += sixPacksIn(static_cast<VLayer>(v));
+            }
+            return origin;
+        }
+
+        constexpr std::int32_t sixPackOrigin(VLayer vLayer, std::int32_t sixPack) const
+        {
+            return (vLayerSixPackOrigin(vLayer) + sixPack) * shape.size();
+        }
+
+        constexpr std::int32_t neuronId(const NeuronCoord& coord) const
+        {
+            return sixPackOrigin(coord.vLayer, coord.sixPack) + shape.layerOffset(coord.packLayer) + coord.index;
+        }
+
+        constexpr NeuronCoord locate(std::int32_t neuronId) const
+        {
+            std::int32_t sixPack = neuronId / shape.size();
+            std::int32_t inPack = neuronId - sixPack * shape.size();
+            std::int32_t v{0};
+            while (v + 1 < vLayerCount && sixPack >= vLayerSixPackOrigin(static_cast<VLayer>(v + 1)))
+            {
+                ++v;
+            }
+            std::int32_t packLayer{0};
+            while (packLayer + 1 < packLayerCount && inPack >= shape.layerOffset(packLayer + 1))
+            {
+                ++packLayer;
+            }
+            return NeuronCoord{static_cast<VLayer>(v), sixPack - vLayerSixPackOrigin(static_cast<VLayer>(v)),
+                               packLayer, inPack - shape.layerOffset(packLayer)};
+        }
+    };
+
+    template <std::int32_t L1Width, std::int32_t L1Depth, std::int32_t LxWidth, std::int32_t LxDepth>
+    struct SixPackShape {
+        static constexpr Shape shape{L1Width, L1Depth, LxWidth, LxDepth};
+        static constexpr std::int32_t size{shape.size()};
+    };
+
+    template <std::int32_t FanOut, typename SixPack>
+    struct TCNTopology {
+        static constexpr Layout layout{FanOut, SixPack::shape};
+        static_assert(layout.valid(), "topology overflows the neuron ids, connection indices or srb handle slots");
+
+        static constexpr std::int32_t fanOut{FanOut};
+        static constexpr std::int32_t IT{layout.sixPacksIn(VLayer::IT)};
+        static constexpr std::int32_t V4{layout.sixPacksIn(VLayer::V4)};
+        static constexpr std::int32_t V2{layout.sixPacksIn(VLayer::V2)};
+        static constexpr std::int32_t V1{layout.sixPacksIn(VLayer::V1)};
+        static constexpr std::int32_t sixPackSize{SixPack::size};
+        static constexpr std::int32_t sixPackCount{static_cast<std::int32_t>(layout.sixPackCount64())};
+        static constexpr std::int32_t neuronCount{static_cast<std::int32_t>(layout.neuronCount64())};
+        static constexpr std::int32_t signalCount{neuronCount * tcnconstants::neuron_signal_ratio};
+        static constexpr std::int32_t connectionCount{neuronCount * tcnconstants::neuron_connection_ratio};
+
+        template <typename T> using PerNeuron = std::array<T, neuronCount>;
+        template <typename T> using PerSixPack = std::array<T, sixPackCount>;
+
+        static constexpr std::int32_t sixPacksIn(VLayer vLayer) { return layout.sixPacksIn(vLayer); }
+        static constexpr std::int32_t sixPackOrigin(VLayer vLayer, std::int32_t sixPack) { return layout.sixPackOrigin(vLayer, sixPack); }
+        static constexpr std::int32_t neuronId(const NeuronCoord& coord) { return layout.neuronId(coord); }
+        static constexpr NeuronCoord locate(std::int32_t neuronId) { return layout.locate(neuronId); }
+
+        template <VLayer vLayer, std::int32_t sixPack>
+        static constexpr std::int32_t origin()
+        {
+            // a fixed SixPack, checked at compile time
+            static_assert(sixPack >= 0 && sixPack < layout.sixPacksIn(vLayer), "no such SixPack in this visual layer");
+            return layout.sixPackOrigin(vLayer, sixPack);
+        }
+    };
+
+    class DynamicTopology
+    {
+        public:
+
+        DynamicTopology(std::int32_t fanOut, const Shape& shape) : layout{fanOut, shape}
+        {
+            if (!layout.valid())
+            {
+                throw std::invalid_argument("DynamicTopology: fan-out " + std::to_string(fanOut) +
+                    " overflows the neuron ids, connection indices or srb handle slots");
+            }
+            this->fanOut = fanOut;
+            IT = layout.sixPacksIn(VLayer::IT);
+            V4 = layout.sixPacksIn(VLayer::V4);
+            V2 = layout.sixPacksIn(VLayer::V2);
+            V1 = layout.sixPacksIn(VLayer::V1);
+            sixPackSize = shape.size();
+            sixPackCount = static_cast<std::int32_t>(layout.sixPackCount64());
+            neuronCount = static_cast<std::int32_t>(layout.neuronCount64());
+            signalCount = neuronCount * tcnconstants::neuron_signal_ratio;
+            connectionCount = neuronCount * tcnconstants::neuron_connection_ratio;
+        }
+
+        Layout layout;
+        std::int32_t fanOut{};
+        std::int32_t IT{};
+        std::int32_t V4{};
+        std::int32_t V2{};
+        std::int32_t V1{};
+        std::int32_t sixPackSize{};
+        std::int32_t sixPackCount{};
+        std::int32_t neuronCount{};
+        std::int32_t signalCount{};
+        std::int32_t connectionCount{};
+
+        std::int32_t sixPacksIn(VLayer vLayer) const { return layout.sixPacksIn(vLayer); }
+        std::int32_t sixPackOrigin(VLayer vLayer, std::int32_t sixPack) const { return layout.sixPackOrigin(vLayer, sixPack); }
+        std::int32_t neuronId(const NeuronCoord& coord) const { return layout.neuronId(coord); }
+        NeuronCoord locate(std::int32_t neuronId) const { return layout.locate(neuronId); }
+    };
+
+    // the network tcnconstants describes
+    using DefaultTopology = TCNTopology<tcnconstants::IT,
+        SixPackShape<tcnconstants::L1_width, tcnconstants::L1_depth, tcnconstants::Lx_width, tcnconstants::Lx_depth>>;
+
+    static_assert(DefaultTopology::sixPackSize == tcnconstants::sixpack_size &&
+                  DefaultTopology::neuronCount == tcnconstants::neuron_count &&
+                  DefaultTopology::V1 == tcnconstants::V1, "TCNTopology disagrees with tcnconstants");
+
+}   // end topology namespace
+
+#endif // TCNTOPOLOGY_H_INCLUDED
@@ -0,0 +1,284 @@
+#ifndef TICKPARTITIONS_H_INCLUDED
+#define TICKPARTITIONS_H_INCLUDED
+
+#include <cstdint>
+#include <climits>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+#include "TCNConstants.h"
+#include "EventWheel.h"
+#include "SignalRingBuffer.h"
+
+/**
+ * @brief TickPartitions
+ *
+ * Splits the neuron pool into contiguous ranges, one per unit of parallel work in a tick, and
+ * holds the per partition work lists that the tick phases hand to each other.
+ *
+ * @details Oct 2026: Partition boundaries are multiples of the alignment, by default
+ * tcnconstants::sixpack_size. The pool is laid out SixPack by SixPack and layer by layer
+ * (IT, V4, V2, V1), so every layer boundary is also a SixPack boundary and a SixPack is
+ * never split between two workers.
+ *
+ * A tick runs in these phases (see Neurons::scanNeuronsForSignals):
+ *    1 parallel    each partition aggregates its due neurons, decides cascades, and writes the
+ *                  signals its cascades will send into its outbox - partition local state only
+ *    2 serial      each partition reserves a block of srb slots, one per outbox entry
+ *    3 parallel    each partition fills its srb block and appends every signal to the inbox of
+ *                  the partition that owns its target
+ *    4 parallel    each partition drains its inbox onto its own neurons' queues
+ *    5 serial      strengthening, event wheel rescheduling and the global next event
+ * Partitions are in neuron id order and each processes its neurons in id order, so the merged
+ * order is the same for any partition count and the parallel engine reproduces the serial one
+ * (one partition) exactly.
+ *
+ * Oct 2026: Inboxes are lock-free multi producer, single consumer stacks of chunks. A producer
+ * fills a private ArrivalChunk per destination and publishes it with one compare-and-swap when
+ * it is full or the producer is done, so there is one atomic operation per chunk, not per signal.
+ * Chunks arrive in any order; every Arrival carries its emission sequence number and the
+ * consumer sorts on it, which restores the serial order before anything is enqueued.
+ * Chunks belong to the producing partition and are reused every tick.
+ */
+
+namespace tick
+{
+    struct Delivery {
+        std::int32_t connId;        // connection that generates the signal
+        std::int32_t target;        // neuron the signal is enqueued on
+        std::int32_t actionTime;    // absolute clock tick of arrival
+        std::int16_t amplitude;     // connection weights at the time of the cascade
+    };
+
+    struct Arrival {
+        std::int32_t target;        // neuron in this partition
+        std::int32_t handle;        // srb::SignalHandle of the emitted signal
+        std::int32_t actionTime;    // saves a trip to the srb when ordering the queue
+        std::int32_t sequence;      // emission order within the tick
+    };
+
+    inline constexpr std::int32_t arrivalChunkSize{256};
+
+    struct ArrivalChunk {
+        ArrivalChunk* next{nullptr};            // link in the inbox stack
+        std::int32_t count{0};
+        Arrival entries[arrivalChunkSize];
+    };
+
+    class ArrivalInbox
+    /**
+     * @brief Lock-free multi producer, single consumer inbox of arrival chunks.
+     */
+    {
+        public:
+
+        void publish(ArrivalChunk* chunk)
+        {
+            // any producer, any time during the emit phase
+            chunk->next = m_head.load(std::memory_order_relaxed);
+            while (!m_head.compare_exchange_weak(chunk->next, chunk,
+                                                 std::memory_order_release, std::memory_order_relaxed))
+            {
+                ;   // chunk->next was refreshed - try again
+            }
+        }
+
+        void drain(std::vector<Arrival>& arrivals)
+        {
+            // the consumer, after the producers have finished: every arrival in emission order
+            for (ArrivalChunk* chunk = m_head.exchange(nullptr, std::memory_order_acquire);
+                 chunk != nullptr; chunk = chunk->next)
+            {
+                arrivals.insert(arrivals.end(), chunk->entries, chunk->entries + chunk->count);
+            }
+            std::sort(arrivals.begin(), arrivals.end(),
+                      [](const Arrival& a, const Arrival& b) { return a.sequence < b.sequence; });
+        }
+
+        private:
+
+        std::atomic<ArrivalChunk*> m_head{nullptr};
+    };
+
+    class ArrivalWriter
+    /**
+     * @brief One producer's open chunks, one per destination inbox, and the chunks it owns.
+     */
+    {
+        public:
+
+        void reset(std::int32_t destinations)
+        {
+            // start of a tick - every chunk is back with its owner
+            m_used = 0;
+            m_open.assign(destinations, nullptr);
+        }
+
+        void append(ArrivalInbox& inbox, std::int32_t destination, const Arrival& arrival)
+        {
+            ArrivalChunk*& chunk = m_open[destination];
+            if (chunk == nullptr)
+            {
+                chunk = nextChunk();
+            }
+            chunk->entries[chunk->count++] = arrival;
+            if (chunk->count == arrivalChunkSize)
+            {
+                inbox.publish(chunk);
+                chunk = nullptr;
+            }
+        }
+
+        template <typename InboxOf>
+        void flush(const InboxOf& inboxOf)
+        {
+            // publish the part filled chunks - inboxOf(destination) names the inbox
+            for (std::int32_t d = 0; d < static_cast<std::int32_t>(m_open.size()); ++d)
+            {
+                if (m_open[d] != nullptr)
+                {
+                    inboxOf(d).publish(m_open[d]);
+                    m_open[d] = nullptr;
+                }
+            }
+        }
+
+        private:
+
+        std::vector<std::unique_ptr<ArrivalChunk>> m_chunks;    // owned, reused tick after tick
+        std::size_t m_used{0};
+        std::vector<ArrivalChunk*> m_open;                      // chunk being filled per destination
+
+        ArrivalChunk* nextChunk()
+        {
+            if (m_used == m_chunks.size())
+            {
+                m_chunks.push_back(std::make_unique<ArrivalChunk>());
+            }
+            ArrivalChunk* chunk = m_chunks[m_used++].get();
+            chunk->count = 0;
+            chunk->next = nullptr;
+            return chunk;
+        }
+    };
+
+    struct Partition {
+        std::int32_t first{0};                      // first neuron in the range
+        std::int32_t last{0};                       // one past the last neuron
+        std::vector<std::int32_t> due;              // phase 1 input: due neurons, ascending
+        std::vector<std::int32_t> contributors;     // phase 1: connections to strengthen, cascade order
+        std::vector<std::int32_t> scratch;          // phase 1: sourceConnIds of the window being aggregated
+        std::vector<Delivery> outbox;               // phase 1: signals raised by this partition's cascades
+        srb::SlotBlock slots;                       // phase 2: srb slots for the outbox
+        std::int32_t firstSequence{0};              // phase 2: emission number of outbox[0]
+        ArrivalWriter writer;                       // phase 3: this partition as a producer
+        ArrivalInbox arrivals;                      // phase 3: emitted signals whose target is in this partition
+        std::vector<Arrival> inbox;                 // phase 4: the arrivals, drained and in emission order
+        std::vector<wheel::WheelEntry> reschedule;  // phases 1 and 4: neurons the event wheel must revisit
+        std::int32_t cascades{0};                   // phase 1: due neurons that cascaded
+
+        void clear(std::int32_t partitions)
+        {
+            // vectors keep their capacity from tick to tick
+            due.clear();
+            contributors.clear();
+            outbox.clear();
+            inbox.clear();
+            reschedule.clear();
+            cascades = 0;
+            writer.reset(partitions);
+        }
+    };
+
+    class TickPartitions
+    {
+        public:
+
+        TickPartitions() : m_partitions(1)
+        {
+            m_partitions[0].last = INT32_MAX;   // one partition covers everything until configured
+        }
+
+        void configure(std::int32_t neuronCount, std::int32_t partitionCount,
+                       std::int32_t alignment = tcnconstants::sixpack_size)
+        /**
+         * @brief Split neuronCount neurons into at most partitionCount ranges aligned to alignment.
+         * There are fewer partitions if there are fewer aligned blocks than partitions asked for.
+         */
+        {
+            alignment = (alignment > 0) ? alignment : 1;
+            std::int32_t blocks = (neuronCount + alignment - 1) / alignment;
+            blocks = (blocks > 0) ? blocks : 1;
+            partitionCount = (partitionCount < blocks) ? partitionCount : blocks;
+            partitionCount = (partitionCount > 0) ? partitionCount : 1;
+
+            m_alignment = alignment;
+            std::vector<Partition> partitions(partitionCount);     // not copyable - the inbox is atomic
+            m_partitions.swap(partitions);
+            m_partitionOfBlock.assign(blocks, 0);
+            for (std::int32_t p = 0; p < partitionCount; ++p)
+            {
+                // equal shares of whole blocks
+                std::int32_t firstBlock = static_cast<std::int32_t>(static_cast<std::int64_t>(blocks) * p / partitionCount);
+                std::int32_t lastBlock = static_cast<std::int32_t>(static_cast<std::int64_t>(blocks) * (p + 1) / partitionCount);
+                Partition& partition = m_partitions[p];
+                partition.first = firstBlock * alignment;
+                partition.last = (lastBlock * alignment < neuronCount) ? lastBlock * alignment : neuronCount;
+                for (std::int32_t b = firstBlock; b < lastBlock; ++b)
+                {
+                    m_partitionOfBlock[b] = p;
+                }
+            }
+        }
+
+        std::int32_t count() const { return static_cast<std::int32_t>(m_partitions.size()); }
+
+        Partition& operator[](std::int32_t p) { return m_partitions[p]; }
+
+        std::int32_t partitionOf(std::int32_t neuronId) const { return m_partitionOfBlock[neuronId / m_alignment]; }
+
+        std::int32_t alignment() const { return m_alignment; }
+
+        std::vector<std::int32_t> firstNeurons() const
+        {
+            // shard boundaries for the signal arena
+            std::vector<std::int32_t> firsts;
+            for (const Partition& partition : m_partitions)
+            {
+                firsts.push_back(partition.first);
+            }
+            return firsts;
+        }
+
+        void splitDue(const std::vector<std::int32_t>& sortedDue)
+        /**
+         * @brief Clear every partition's work lists and hand it its share of the ascending due list.
+         */
+        {
+            for (Partition& partition : m_partitions)
+            {
+                partition.clear(count());
+            }
+            std::int32_t p{0};
+            for (std::int32_t neuronId : sortedDue)
+            {
+                while (neuronId >= m_partitions[p].last)
+                {
+                    ++p;
+                }
+                m_partitions[p].due.push_back(neuronId);
+            }
+        }
+
+        private:
+
+        std::vector<Partition> m_partitions;
+        std::vector<std::int32_t> m_partitionOfBlock{0};    // partition index per aligned block
+        std::int32_t m_alignment{INT32_MAX};
+    };
+
+}   // end tick namespace
+
+#endif // TICKPARTITIONS_H_INCLUDED
@@ -0,0 +1,69 @@
+#ifndef TRACE_H_INCLUDED
+#define TRACE_H_INCLUDED
+
+#include <iostream>
+#include <string>
+#include "Logger.h"
+
+/**
+ * @brief Compile-time tracing for the simulation hot path.
+ *
+ * @details Oct 2026: generateOutGoingSignals, generateASignal, scanNeuronsForSignals and the
+ * pool constructors print several lines per signal and per neuron. In a production run that I/O
+ * costs far more than the simulation itself, so every trace statement is now gated by a
+ * constexpr level check. A statement below the compiled trace level is a discarded
+ * `if constexpr` branch - it must still compile but no code is emitted for it.
+ *
+ * TCN_TRACE_LEVEL uses the LogLevel values from Logger.h:
+ *      0 DEBUG     per signal and per neuron detail - today's full output
+ *      1 INFO      per scan / per cascade / pool setup summaries
+ *      2 WARNING
+ *      3 ERROR
+ *      4 CRITICAL
+ *      5           tracing compiled out
+ *
+ * When the build does not say otherwise a debug build (no NDEBUG) traces everything, exactly as
+ * before, and a release build (-DNDEBUG) compiles all tracing out.
+ * e.g.   g++ -O2 -DNDEBUG ...                      quiet production build
+ *        g++ -O2 -DNDEBUG -DTCN_TRACE_LEVEL=1 ...  release build with summaries only
+ *
+ * Usage:
+ *      TCN_TRACE(DEBUG, "\nSignal action time: " << std::to_string(actionTime));
+ *      TCN_TRACE_DO(DEBUG, srbObj.printSignalFromIndex(slot));
+ */
+
+#ifndef TCN_TRACE_LEVEL
+    #ifdef NDEBUG
+        #define TCN_TRACE_LEVEL 5
+    #else
+        #define TCN_TRACE_LEVEL 0
+    #endif
+#endif
+
+namespace trace
+{
+    inline constexpr int traceOff{CRITICAL + 1};
+    inline constexpr int traceLevel{TCN_TRACE_LEVEL};
+
+    // true when statements at this level are compiled in
+    template <LogLevel level>
+    inline constexpr bool enabled{static_cast<int>(level) >= traceLevel && traceLevel < traceOff};
+}
+
+// stream an expression to std::cout when level is compiled in
+#define TCN_TRACE(level, streamExpr)                    \
+    do {                                                \
+        if constexpr (trace::enabled<level>) {          \
+            std::cout << streamExpr;                    \
+        }                                               \
+    } while (0)
+
+// run a statement (usually one of the print helpers) when level is compiled in
+#define TCN_TRACE_DO(level, statement)                  \
+    do {                                                \
+        if constexpr (trace::enabled<level>) {          \
+            statement;                                  \
+        }                                               \
+    } while (0)
+
+#endif // TRACE_H_INCLUDED
@@ -0,0 +1,186 @@
+#ifndef WORKERPOOL_H_INCLUDED
+#define WORKERPOOL_H_INCLUDED
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+/**
+ * @brief WorkerPool
+ *
+ * Fixed set of worker threads that run the tasks of one parallel phase and meet at a barrier.
+ *
+ * @details Oct 2026: run(tasks, fn) calls fn(0) .. fn(tasks - 1) spread over the workers plus
+ * the calling thread, and returns only when every task has finished - that return is the tick
+ * barrier. Tasks are handed out through one atomic counter, so a partition that finishes early
+ * picks up the next one. The threads are started once and sleep on a condition variable between
+ * phases; nothing is allocated per phase.
+ *
+ * A pool of one thread has no workers at all and run() is a plain loop on the caller, which is
+ * how the serial engine runs exactly the same code as the parallel one.
+ *
+ * The first exception thrown by a task is re-thrown by run() once the barrier is reached.
+ */
+
+namespace workers
+{
+    class WorkerPool
+    {
+        public:
+
+        explicit WorkerPool(std::int32_t threads = 1)
+        {
+            start(threads);
+        }
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        ~WorkerPool()
+        {
+            stop();
+        }
+
+        std::int32_t size() const { return static_cast<std::int32_t>(m_threads.size()) + 1; }
+
+        void resize(std::int32_t threads)
+        /**
+         * @brief Restart with threads in total, counting the caller; 0 means one per hardware thread.
+         */
+        {
+            stop();
+            start(threads);
+        }
+
+        void run(std::int32_t tasks, const std::function<void(std::int32_t)>& task)
+        {
+            if (m_threads.empty() || tasks <= 1)
+            {
+                for (std::int32_t i = 0; i < tasks; ++i)
+                {
+                    task(i);
+                }
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_task = &task;
+                m_taskCount = tasks;
+                m_nextTask.store(0, std::memory_order_relaxed);
+                m_busy = static_cast<std::int32_t>(m_threads.size());
+                m_error = nullptr;
+                ++m_generation;
+            }
+            m_wake.notify_all();
+
+            work();     // the caller takes tasks as well
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this] { return m_busy == 0; });
+            m_task = nullptr;
+            if (m_error)
+            {
+                std::exception_ptr error = m_error;
+                m_error = nullptr;
+                std::rethrow_exception(error);
+            }
+        }
+
+        private:
+
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;         // workers wait here for the next phase
+        std::condition_variable m_done;         // caller waits here for the barrier
+        const std::function<void(std::int32_t)>* m_task{nullptr};
+        std::int32_t m_taskCount{0};
+        std::atomic<std::int32_t> m_nextTask{0};
+        std::int32_t m_busy{0};                 // workers still in the current phase
+        std::uint64_t m_generation{0};          // bumped once per run()
+        bool m_stop{false};
+        std::exception_ptr m_error{nullptr};
+
+        void start(std::int32_t threads)
+        {
+            if (threads <= 0)
+            {
+                threads = static_cast<std::int32_t>(std::thread::hardware_concurrency());
+                threads = (threads > 0) ? threads : 1;
+            }
+            m_stop = false;
+            std::uint64_t generation = m_generation;    // a late starting thread must not miss a phase
+            for (std::int32_t t = 1; t < threads; ++t)
+            {
+                m_threads.emplace_back([this, generation] { workerLoop(generation); });
+            }
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (std::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+            m_threads.clear();
+        }
+
+        void work()
+        {
+            for (;;)
+            {
+                std::int32_t i = m_nextTask.fetch_add(1, std::memory_order_relaxed);
+                if (i >= m_taskCount)
+                {
+                    return;
+                }
+                try
+                {
+                    (*m_task)(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_error)
+                    {
+                        m_error = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        void workerLoop(std::uint64_t seen)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (;;)
+            {
+                m_wake.wait(lock, [this, seen] { return m_stop || m_generation != seen; });
+                if (m_stop)
+                {
+                    return;
+                }
+                seen = m_generation;
+                lock.unlock();
+                work();
+                lock.lock();
+                if (--m_busy == 0)
+                {
+                    m_done.notify_one();
+                }
+            }
+        }
+    };
+
+}   // end workers namespace
+
+#endif // WORKERPOOL_H_INCLUDED
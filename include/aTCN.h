@@ -106,6 +106,20 @@ namespace tcn
                 requires                        372 MB  744 MB  1.16 GB 1.48 GB  1.86 GB
 
             Therefore 1 GB can house ~2 million neurons with 10x connections + signals
+
+            Oct 2026 structure of arrays neuron pool:
+                nextEvent + refractoryEnd        8 bytes per neuron, the only part scanned every tick
+                CSR fan-out offset               4 bytes per neuron
+                incomingSignals queue header    16 bytes per neuron, entries live in the signal arena slab
+                signal arena slab                4 bytes x neuron_signal_ratio per neuron at start up
+                CSR fan-out entries              4 bytes per connection, one block for the whole pool
+                active set                       4 bytes per neuron, plus 4 per neuron with anything pending
+            The outgoing queue vectors are gone so there is no per neuron heap block for fan-out.
+
+            Oct 2026 packed connection pool (Connections::packPool):
+                hot record                       6 bytes per connection, all the fan-out reads
+                cold record                      6 bytes per connection, learning state only
+            16 bytes per connection with the CSR entry instead of 20 - 160 MB for 10 million.
     */
 
     // make sure we start processing with the oldest clocks
@@ -144,7 +158,8 @@ namespace tcn
 
         // Build all the connections in the network
         // This will call the vertical horiztonal, forward, and backward connection builders
-        // TODO build these algorithms
+        // Oct 2026: built - netbuild::buildConnectionNetwork and the five family builders in
+        // NetworkBuilder.h, over a topology::TCNTopology instead of the LVIT .. LV1 nets
         //        void buildConnectionNetwork(int x, int y, int z);
         //
         //        // TODO - forward connections up the stack - Purkinje
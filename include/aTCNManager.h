@@ -2,17 +2,19 @@
 #define ATCNMANAGER_H
 
 #include <iostream>
-#include <limits>
-#include "aTCN.h"
+#include <climits>
+#include <cstdint>
 #include <vector>
+#include <memory>
+#include <algorithm>
+#include <functional>
 
 #include "TCNConstants.h"
+#include "TCNState.h"
+#include "Neurons.h"
 
-using namespace tcn;
-using namespace std;
-using namespace neurons;
-using namespace srb;
-using namespace tcnconstants;
+// Oct 2026: the using directives and aTCN.h are gone - the manager schedules tcn::TCNState
+// networks, and aTCN.h's builders (LVIT/LV4/LV2/LV1) are not buildable yet.
 
 namespace tcnmanager
 {
@@ -38,54 +40,54 @@ namespace tcnmanager
     /*  Global clock management
         This is the current clock value all tcn's should be processing
         It should be the lowest l_f_c from any neuron in any tcn.
+
+        Oct 2026: Done. The manager is a serial scheduler: it runs any number of TCNs in one
+        process, one at a time. Every parked TCN with work is in a min-heap keyed on its next event
+        (globalNextEvent), ties broken by tcn number. advance() takes the lowest future clock off
+        the top as the master_clock and runs every TCN due inside the time slice
+        [master_clock, master_clock + slice), one after another in heap order, each running all
+        of its ticks inside the slice before the next is swapped in. A TCN with nothing scheduled
+        is not in the heap at all, so idle networks cost nothing.
+
+        The tick engine lives in the process globals, so only one TCN is ever live - TCNs never
+        run concurrently. The only parallelism is inside each TCN's ticks, on the tick workers
+        every TCN shares. A slice of 1 advances the TCNs in strict global clock order; a wider one
+        swaps less but lets one TCN's clock run up to slice - 1 ticks ahead of another's. TCNs do
+        not exchange signals yet, so any slice gives the same results; once they do, the slice
+        must be no wider than the shortest delay between them.
+
+        Not done - open follow-up: running the TCNs due inside one slice in parallel, one per
+        WorkerPool thread, with the slice as the conservative synchronization window. It needs
+        the engine state the tick code reads - the pools, clocks, srb, event wheel and tick
+        partitions, now process globals swapped by TCNState - to be reached through a per-TCN
+        context instead, so two networks can tick at once.
     */
 
     //  These are global; anyone can reference or set them //
-    int master_clock{0}; // starts out at zero
-    int l_f_c{0};        // lowest future clock
-    int n_l_f_c{0};      // next lowest future clock
+    int master_clock{0};        // start of the slice being processed
+    int l_f_c{INT_MAX};         // lowest future clock - any plausible clock value will be less
+    int n_l_f_c{INT_MAX};       // next lowest future clock, from a different TCN
+
+    struct NextEvent {
+        std::int32_t clock;     // TCN's globalNextEvent
+        std::int32_t tcnNo;     // index in tcn_list - breaks ties so the order is deterministic
+    };
 
     class aTCNManager
     {
     public:
-        aTCN *firstTCN;
-        // tcn be processed
-        // for now this is a global for a single tcn. In the future it will become a local for multi-thread support
-        static aTCN current_tcn;
-
-        /*  these are all moved to Tcnconstants as they are truly global
-            for all TCNs
-
-            // tcn global clock parameters
-            static  int tpm = 5;        // ticks per millisecond for tcn's
-            static  int agw = 5;        // how many clock ticks are eligible for signal aggregation
-            static  float sdf = 0.5;   // signal decay factor - reduces to 1/32 over 5 ticks
-
-            // threshold to cascade a node
-            static  float cascade = 125000;
-
-        */
-        /*
-            // connection STP aging factors
-            static  float   STP_decay   =   0.41;       // exponential decay factor
-            static  float   STP_boost   =   0.25;       // repeat signal lift
-            static  float   max_signal  =   220;        // limit to signal boost
-            static  float   min_signal  =   100;        // base value for a signal
-
-            static  int STP_aging_interval  =   60*1000*tpm;    // in clock tick units ( one minute )
-            static  int STP_intervals       =   15;             // intervals over which to age STP
-
-            // When we process the tcns, just look for the tcn that has the least l_f_c lowest_future_clock
-        */
-        //    aTCNManager ();
-
-        void select(int tcn_no);
+
+        explicit aTCNManager(std::int32_t threads = 1)
         /**
-         * @brief   Selects the next TCN to be processed by the TCNManager
-         *          4/8/2025: Just picks the only one for now
-         *
+         * @brief   Start with no TCNs and threads tick workers shared by all of them (0 = one per
+         *          hardware thread). The workers split each tick; TCNs themselves run one at a time.
          */
-        aTCNManager(tcn_no);
+        {
+            tickWorkers.resize(threads);
+        }
+
+        aTCNManager(const aTCNManager&) = delete;
+        aTCNManager& operator=(const aTCNManager&) = delete;
 
         ~aTCNManager()
         /**
@@ -93,16 +95,161 @@ namespace tcnmanager
          *
          */
         {
-            // tcn being processed
-            // Currently this is a singular global.
-            // It will have to become a multi-valued local when we go multi-thread
-            tcn_list.pop_back();
-            delete firstTCN;
+            park();     // leave the globals as they were before the manager
+        }
+
+        std::int32_t addTCN(const std::function<void()>& build)
+        /**
+         * @brief   Create a TCN and return its tcn number.
+         *
+         * @details build() runs with the new, empty TCN live and builds it the usual way - pool
+         *          constructors, connections, seed signals and eventWheel entries all go into the
+         *          globals. The TCN is then parked, and queued if it has anything scheduled.
+         */
+        {
+            park();
+            std::int32_t tcnNo = static_cast<std::int32_t>(tcn_list.size());
+            tcn_list.push_back(std::make_unique<tcn::TCNState>());
+            activate(tcnNo);
+            build();
+            park();
+            return tcnNo;
+        }
+
+        void select(int tcn_no)
+        /**
+         * @brief   Make a TCN live so its globals can be read or changed - e.g. to feed it input.
+         *          4/8/2025: Just picks the only one for now
+         *          Oct 2026: any TCN; it is re-queued on its new next event when it is parked.
+         */
+        {
+            if (tcn_no == m_active)
+            {
+                return;
+            }
+            park();
+            auto queued = std::find_if(m_heap.begin(), m_heap.end(),
+                                       [tcn_no](const NextEvent& e) { return e.tcnNo == tcn_no; });
+            if (queued != m_heap.end())
+            {
+                m_heap.erase(queued);
+                std::make_heap(m_heap.begin(), m_heap.end(), later);
+            }
+            activate(tcn_no);
+        }
+
+        void park()
+        /**
+         * @brief   Swap the live TCN, if any, back out of the globals and queue it on its next event.
+         */
+        {
+            if (m_active < 0)
+            {
+                return;
+            }
+            globalNextEvent = eventWheel.nextEventTime();
+            tcn::TCNState& state = *tcn_list[m_active];
+            state.swapGlobals();
+            if (state.globalNextEvent != INT32_MAX)
+            {
+                m_heap.push_back(NextEvent{state.globalNextEvent, m_active});
+                std::push_heap(m_heap.begin(), m_heap.end(), later);
+            }
+            m_active = -1;
+            updateFutureClocks();
+        }
+
+        std::int32_t advance(std::int32_t slice = 1)
+        /**
+         * @brief   Run every TCN due in one time slice, one after another, and return the slice's
+         *          start, the new master_clock; INT32_MAX when no TCN has anything left to do.
+         */
+        {
+            park();
+            if (m_heap.empty())
+            {
+                return INT32_MAX;
+            }
+            master_clock = m_heap.front().clock;
+            slice = (slice > 0) ? slice : 1;
+            std::int32_t sliceEnd = (master_clock < INT32_MAX - slice) ? master_clock + slice : INT32_MAX;
+
+            m_due.clear();
+            while (!m_heap.empty() && m_heap.front().clock < sliceEnd)
+            {
+                std::pop_heap(m_heap.begin(), m_heap.end(), later);
+                m_due.push_back(m_heap.back().tcnNo);
+                m_heap.pop_back();
+            }
+
+            for (std::int32_t tcnNo : m_due)
+            {
+                activate(tcnNo);
+                tcn::TCNState& state = *tcn_list[tcnNo];
+                ++state.activations;
+                for (std::int32_t next = eventWheel.nextEventTime(); next < sliceEnd; next = eventWheel.nextEventTime())
+                {
+                    masterClock = next;
+                    m_engine.scanNeuronsForSignals();
+                    ++state.ticks;
+                }
+                park();
+            }
+            return master_clock;
+        }
+
+        std::int64_t run(std::int32_t until, std::int32_t slice = 1)
+        /**
+         * @brief   Advance slice after slice until every TCN is idle or past until; returns the
+         *          number of slices processed.
+         */
+        {
+            std::int64_t slices{0};
+            park();
+            while (l_f_c < until && advance(slice) != INT32_MAX)
+            {
+                ++slices;
+            }
+            return slices;
         }
 
+        std::int32_t count() const { return static_cast<std::int32_t>(tcn_list.size()); }
+
+        std::int32_t active() const { return m_active; }
+
+        const tcn::TCNState& state(std::int32_t tcn_no) const { return *tcn_list[tcn_no]; }
+
     private:
-        // array of tcns to be managed - for now just one
-        vector<aTCN *> tcn_list;
+        // tcns to be managed; only the one in the globals (m_active) is out of date here
+        std::vector<std::unique_ptr<tcn::TCNState>> tcn_list;
+        std::vector<NextEvent> m_heap;      // min-heap of parked TCNs with work
+        std::vector<std::int32_t> m_due;    // TCNs taken off the heap for the current slice
+        std::int32_t m_active{-1};          // TCN live in the globals, -1 for none
+        neurons::Neurons m_engine{};        // the tick code; keeps no network state of its own
+
+        static bool later(const NextEvent& a, const NextEvent& b)
+        {
+            // heap order - std heaps keep the largest on top, so compare reversed
+            return (a.clock != b.clock) ? a.clock > b.clock : a.tcnNo > b.tcnNo;
+        }
+
+        void activate(std::int32_t tcnNo)
+        {
+            // caller has parked the previous TCN and taken this one off the heap
+            tcn_list[tcnNo]->swapGlobals();
+            m_active = tcnNo;
+        }
+
+        void updateFutureClocks()
+        {
+            // the top of the heap and the earlier of its children
+            l_f_c = m_heap.empty() ? INT_MAX : m_heap[0].clock;
+            n_l_f_c = INT_MAX;
+            for (std::size_t child = 1; child < 3 && child < m_heap.size(); ++child)
+            {
+                n_l_f_c = (m_heap[child].clock < n_l_f_c) ? m_heap[child].clock : n_l_f_c;
+            }
+        }
     };
 
 } // end tcnmanager namespace
@@ -1,34 +1,10 @@
-#include <iostream>
-#include <vector>
-#include <climits>
-#include <cassert>
-
 #include "aTCNManager.h"
-#include "aTCN.h"
-
-using namespace tcnconstants;
-using namespace std;
-using namespace tcn;
-
-int aTCNManager::master_clock{0};
-int aTCNManager::l_f_c{INT_MAX};   // any plausible clock value will be less than this initial value
-int aTCNManager::n_l_f_c{INT_MAX}; // any plausible clock value will be less that this initial value
-aTCN aTCNManager::current_tcn;     // tcn being processed
-
-extern aTCN *firstTCN;
-
-aTCNManager::aTCNManager(int tcnet = 0)
-{
-    // ctor
-    //  for now, allocate and enqueue a single tcn
 
-    firstTCN = new aTCN(tcnet); // first tcn in the list of tcns.
-    tcn_list.push_back(firstTCN);
-}
+/**
+ * @brief Oct 2026: everything is in aTCNManager.h - just like a headers-only library,
+ * the same as aTCN.cpp.
+ *
+ */
 
-void aTCNManager::select()
-// Jan 2019, single TCN, single thread
-{
-    l_f_c = INT_MAX; // force smaller tcn lfc to be selected.
-    current_tcn = *tcn_list[0];
-}
+// The Jan 2019 single TCN, single thread select() and the static master_clock, l_f_c and
+// n_l_f_c definitions that lived here are replaced by the min-heap scheduler in the header.
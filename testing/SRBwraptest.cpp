@@ -1,4 +1,5 @@
 #undef TESTING_MODE
+#define TCN_SIGNAL_TEST_IDS 1      // the log prints each slot's test id
 
 #include <iostream>
 #include <vector>
@@ -11,6 +12,7 @@
 extern std::int32_t currentSignalSlot;
 extern std::int32_t signalBufferCapacity;
 extern std::vector<signal::Signal> m_srb;
+std::int32_t masterClock{0};    // the srb's clock; no neuron pool here
 
 /**
  * @brief Run multiple allocations to ensure that a small srb wraps (currently capacity of 50).
@@ -47,7 +49,8 @@ extern std::vector<signal::Signal> m_srb;
         * @brief  Pseudo-allocateSignalSlot
         */
 
-        if (currentSignalSlot >= signalBufferCapacity) {
+        // Oct 2026: the last slot is capacity - 1, as in allocateSignalSlot - the test id table ends there
+        if (currentSignalSlot >= signalBufferCapacity - 1) {
             currentSignalSlot = 0;
             nextSlot = 0;
         }
@@ -57,7 +60,7 @@ extern std::vector<signal::Signal> m_srb;
       // now for some logging
 
       // std::cout << SRB.getSlotRef(nextSlot).testId << " ";
-      std::string msg = "Slot idx: " + std::to_string(nextSlot) + " SlotId: " + std::to_string(SRB.getSlotRef(nextSlot).testId);
+      std::string msg = "Slot idx: " + std::to_string(nextSlot) + " SlotId: " + std::to_string(SRB.getSlotTestId(nextSlot));
       logger.log(INFO,msg  );
     }
 
@@ -0,0 +1,24 @@
+#ifndef TESTCHECK_H_INCLUDED
+#define TESTCHECK_H_INCLUDED
+
+#include <iostream>
+#include <cstdint>
+
+/**
+ * @brief TestCheck
+ *
+ * The check scaffold the testing programs share.
+ *
+ * @details Oct 2026: every test is a standalone program that prints a PASS or FAIL line for
+ * each check it makes and returns failures, the number that failed, from main().
+ */
+
+inline std::int32_t failures{0};
+
+inline void check(bool condition, const char* what)
+{
+  std::cout << (condition ? "PASS: " : "FAIL: ") << what << '\n';
+  failures += condition ? 0 : 1;
+}
+
+#endif // TESTCHECK_H_INCLUDED
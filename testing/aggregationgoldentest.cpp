@@ -0,0 +1,136 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "AggregationKernel.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern std::vector<signal::Signal> m_srb;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Golden values for signal aggregation and the cascade decisions they lead to.
+ *
+ * @details A signal d ticks old counts for amplitude / 2^d inside the 5 tick window, rounded
+ * toward zero. The values below were worked out by hand from aggregation_decay_factor and
+ * aggregation_window_ticks; if either constant changes this test has to be redone.
+ *
+ * Each cascade case is a neuron with its own queue of signals, all scanned in one tick at the
+ * same masterClock. Before the kernel only distance 0 counted, so the cases that need older
+ * signals to reach the threshold did not cascade.
+ *
+ * The recording accumulate() must give the same sums and name exactly the signals inside the
+ * window as contributors, in queue order. The ids are negative - no source connection - so the
+ * scan strengthens nothing.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+struct Arrival {
+  int32_t age;            // ticks before the masterClock
+  int16_t amplitude;
+};
+
+struct Case {
+  const char* what;
+  std::vector<Arrival> signals;
+  bool cascades;
+};
+
+int main ()
+{
+  constexpr int32_t clock{1000};
+
+  // decayed() against the values worked out by hand
+  check(aggregation::decayed(10000, 0) == 10000 && aggregation::decayed(10000, 1) == 5000 &&
+        aggregation::decayed(10000, 2) == 2500 && aggregation::decayed(10000, 3) == 1250 &&
+        aggregation::decayed(10000, 4) == 625, "10000 decays to 5000, 2500, 1250, 625");
+  check(aggregation::decayed(-999, 2) == -249 && aggregation::decayed(-1, 1) == 0 &&
+        aggregation::decayed(-32768, 4) == -2048, "inhibitory amplitudes round toward zero");
+  check(aggregation::decayed(7, 3) == 0 && aggregation::decayed(32767, 4) == 2047, "small and largest amplitudes");
+
+  const std::vector<Case> cases = {
+    { "one signal at the threshold, due now",                     { {0, 12000} },                               true  },
+    { "one signal just under the threshold",                      { {0, 11999} },                               false },
+    { "8000 now + 8000 one tick old = 12000",                     { {0, 8000}, {1, 8000} },                     true  },
+    { "8000 now + 7999 one tick old = 11999",                     { {0, 8000}, {1, 7999} },                     false },
+    { "6000 now + 6000 at 1 + 12000 at 2 = 12000",                { {0, 6000}, {1, 6000}, {2, 12000} },         true  },
+    { "4000 now + 16000 at 1 + 16000 at 2 = 16000",               { {0, 4000}, {1, 16000}, {2, 16000} },        true  },
+    { "10000 now + 16000 at 4 = 11000",                           { {0, 10000}, {4, 16000} },                   false },
+    { "11000 now + 16000 at 4 = 12000",                           { {0, 11000}, {4, 16000} },                   true  },
+    { "11000 now + 32000 at 5 is outside the window",             { {0, 11000}, {5, 32000} },                   false },
+    { "12000 now + -1 one tick old rounds to 0",                  { {0, 12000}, {1, -1} },                      true  },
+    { "12000 now + -8 three ticks old = -1",                      { {0, 12000}, {3, -8} },                      false },
+    { "20000 now + -32000 at 1 + 32000 at 2 = 12000",             { {0, 20000}, {1, -32000}, {2, 32000} },      true  },
+  };
+  const int32_t neuronCount = static_cast<int32_t>(cases.size());
+
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(100);
+  conns::Connections connections = conns::Connections(10);
+  neurons::Neurons neurons = neurons::Neurons(neuronCount);
+  masterClock = clock - 10;
+  eventWheel.reset(masterClock);
+
+  // queue every case's signals on its own neuron, as if they had been delivered earlier
+  for (int32_t n = 0; n < neuronCount; ++n)
+  {
+    for (const Arrival& arrival : cases[n].signals)
+    {
+      int32_t slot = ring.allocateSignalSlot();
+      m_srb[slot] = srb::makeSignal(clock - arrival.age, -slot - 1, arrival.amplitude);
+      connections.enqueueSignal(n, srb::makeHandle(slot), srb::actionTime(m_srb[slot]));
+    }
+    m_neuronPool.nextEvent[n] = clock;                     // due now
+    m_neuronPool.refractoryEnd[n] = clock - 50;            // long out of refractory
+    eventWheel.schedule(n, clock);
+  }
+
+  // the kernel alone, then the scan
+  std::vector<int32_t> accumulators(neuronCount);
+  bool recorded{true};
+  for (int32_t n = 0; n < neuronCount; ++n)
+  {
+    arena::SignalQueue queue = m_neuronPool.incomingSignals[n];
+    accumulators[n] = aggregation::accumulate(queue.begin(), queue.end(), m_srb.data(), clock);
+    std::vector<int32_t> expected;
+    for (srb::SignalHandle handle : queue)
+    {
+      const signal::Signal& sRef = m_srb[srb::handleSlot(handle)];
+      if (srb::actionTime(sRef) <= clock && srb::actionTime(sRef) > clock - tconst::aggregation_window_ticks)
+      {
+        expected.push_back(sRef.sourceConnId);
+      }
+    }
+    std::vector<int32_t> contributors(queue.size());
+    int32_t count{-1};
+    int32_t accumulator = aggregation::accumulate(queue.begin(), queue.end(), m_srb.data(), clock,
+                                                  contributors.data(), count);
+    contributors.resize(count < 0 ? 0 : static_cast<std::size_t>(count));
+    recorded = recorded && accumulator == accumulators[n] && contributors == expected;
+  }
+  check(recorded, "recording accumulate names the signals inside the window");
+
+  masterClock = clock;
+  neurons.scanNeuronsForSignals();
+  std::cout << '\n';
+
+  for (int32_t n = 0; n < neuronCount; ++n)
+  {
+    bool cascaded = m_neuronPool.refractoryEnd[n] == clock + tconst::refractoryWidth;
+    std::cout << "  accumulator " << accumulators[n] << " - ";
+    check(cascaded == cases[n].cascades && (accumulators[n] >= tconst::cascadeThreshold) == cases[n].cascades,
+          cases[n].what);
+  }
+
+  std::cout << "\naggregationgoldentest failures:= " << failures << std::endl;
+  return failures;
+}
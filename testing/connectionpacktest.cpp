@@ -0,0 +1,272 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "FanOutKernel.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern int32_t currentSignalSlot;
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief The packed hot/cold connection pool behaves exactly like the Connection pool.
+ *
+ * @details A random pool - blank connections, every target and distance the packed layout can
+ * hold, weights near the int16 limits - must come back unchanged from pack and unpack, and
+ * connections that do not fit must be rejected without touching the pool. The packed fan-out
+ * kernel must give the Deliveries, earliest actionTime and lastSignalOriginTime stamps of the
+ * Connection kernel. Finally a random network is run tick by tick with the Connection pool and
+ * with the packed pool, with one and four threads: neuron state and srb contents must match on
+ * every tick and the connections must match at the end. Build with and without -mavx2 to cover
+ * both kernel paths.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+constexpr int32_t sixPacks{12};
+constexpr int32_t poolSize{sixPacks * tconst::sixpack_size};
+constexpr int32_t fanOut{12};
+constexpr int32_t ringSize{20000};
+constexpr int32_t ticks{200};
+
+bool same(const connection::Connection& a, const connection::Connection& b)
+{
+  return a.targetNeuronSlot == b.targetNeuronSlot && a.lastSignalOriginTime == b.lastSignalOriginTime &&
+         a.temporalDistanceToTarget == b.temporalDistanceToTarget && a.stpWeight == b.stpWeight &&
+         a.ltpWeight == b.ltpWeight;
+}
+
+bool sameDeliveries(const std::vector<tick::Delivery>& a, const std::vector<tick::Delivery>& b)
+{
+  if (a.size() != b.size())
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    if (a[i].connId != b[i].connId || a[i].target != b[i].target ||
+        a[i].actionTime != b[i].actionTime || a[i].amplitude != b[i].amplitude)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool rejects(const connection::Connection& conn)
+{
+  std::vector<connection::Connection> pool(3, connection::Connection{-1, -1, -1, -1, -1});
+  pool[1] = conn;
+  std::vector<connection::HotConnection> hot(1);
+  std::vector<connection::ColdConnection> cold(1);
+  try
+  {
+    connection::pack(pool, hot, cold);
+  }
+  catch (const std::out_of_range&)
+  {
+    return hot.size() == 1 && cold.size() == 1;
+  }
+  return false;
+}
+
+uint64_t fold(uint64_t digest, int64_t value)
+{
+  // FNV-1a over the value's bytes
+  for (int i = 0; i < 8; ++i)
+  {
+    digest ^= static_cast<uint64_t>(value >> (8 * i)) & 0xFF;
+    digest *= 1099511628211ULL;
+  }
+  return digest;
+}
+
+uint64_t stateDigest()
+{
+  uint64_t digest{14695981039346656037ULL};
+  digest = fold(digest, masterClock);
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    digest = fold(digest, m_neuronPool.nextEvent[n]);
+    digest = fold(digest, m_neuronPool.refractoryEnd[n]);
+    for (srb::SignalHandle handle : m_neuronPool.incomingSignals[n])
+    {
+      digest = fold(digest, handle);
+    }
+  }
+  digest = fold(digest, currentSignalSlot);
+  for (const signal::Signal& s : m_srb)
+  {
+    digest = fold(digest, srb::actionTime(s));
+    digest = fold(digest, s.sourceConnId);
+    digest = fold(digest, s.amplitude);
+  }
+  return digest;
+}
+
+std::vector<uint64_t> runNetwork(neurons::Neurons& neurons, conns::Connections& connections, int32_t threads,
+                                 bool packed, std::vector<connection::Connection>& finalPool)
+{
+  connections.unpackPool();
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+  m_neuronPool.resize(poolSize, INT32_MAX, -tconst::refractoryWidth - 1);
+  neurons.setTickThreads(threads);
+  masterClock = 0;
+  eventWheel.reset(masterClock);
+
+  std::mt19937 rng(20261017);
+  int32_t conn{1};
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    for (int32_t f = 0; f < fanOut; ++f, ++conn)
+    {
+      int32_t target = static_cast<int32_t>(rng() % poolSize);
+      int32_t distance = 1 + static_cast<int32_t>(rng() % 12);
+      int16_t weight = static_cast<int16_t>(4000 + rng() % 9000);
+      m_connPool[conn] = connection::Connection{target, 0, distance, weight, static_cast<int16_t>(rng() % 50)};
+      m_neuronPool.addOutgoing(n, conn);
+    }
+  }
+  m_neuronPool.buildOutgoingIndex();
+  if (packed)
+  {
+    connections.packPool();
+  }
+
+  for (int32_t i = 0; i < poolSize / 8; ++i)
+  {
+    int32_t target = static_cast<int32_t>(rng() % poolSize);
+    int32_t slot = ring.allocateSignalSlot();
+    m_srb[slot] = srb::makeSignal(1 + static_cast<int32_t>(rng() % 20), 0, tconst::cascadeThreshold);
+    if (connections.enqueueSignal(target, srb::makeHandle(slot), srb::actionTime(m_srb[slot])))
+    {
+      eventWheel.schedule(target, srb::actionTime(m_srb[slot]));
+    }
+  }
+
+  std::vector<uint64_t> digests;
+  for (int32_t t = 0; t < ticks && neurons.advanceMasterClock() != INT32_MAX; ++t)
+  {
+    neurons.scanNeuronsForSignals();
+    digests.push_back(stateDigest());
+  }
+  connections.unpackPool();
+  finalPool = m_connPool;
+  return digests;
+}
+
+int main ()
+{
+  std::mt19937 rng(20261017);
+
+  // conversion
+  std::vector<connection::Connection> pool(5000);
+  for (connection::Connection& conn : pool)
+  {
+    bool blank = rng() % 10 == 0;
+    conn.targetNeuronSlot = blank ? -1 : static_cast<int32_t>(rng() % (connection::maxPackedTarget + 1));
+    conn.lastSignalOriginTime = static_cast<int32_t>(rng());
+    conn.temporalDistanceToTarget = blank ? -1 : 1 + static_cast<int32_t>(rng() % connection::maxPackedDistance);
+    conn.stpWeight = static_cast<int16_t>(static_cast<int32_t>(rng() % 60001) - 30000);
+    conn.ltpWeight = static_cast<int16_t>(static_cast<int32_t>(rng() % 5001) - 2500);
+  }
+  pool[1] = connection::Connection{connection::maxPackedTarget, 0, connection::maxPackedDistance, INT16_MAX, 0};
+  pool[2] = connection::Connection{0, INT32_MIN, connection::minTemporalDistance, INT16_MIN, 0};
+  std::vector<connection::HotConnection> hot;
+  std::vector<connection::ColdConnection> cold;
+  std::vector<connection::Connection> unpacked;
+  connection::pack(pool, hot, cold);
+  connection::unpack(hot, cold, unpacked);
+  bool roundTrip = unpacked.size() == pool.size();
+  for (std::size_t c = 0; roundTrip && c < pool.size(); ++c)
+  {
+    roundTrip = same(pool[c], unpacked[c]);
+  }
+  check(roundTrip, "pack then unpack gives the pool back, blanks and limits included");
+  check(rejects({connection::maxPackedTarget + 1, 0, 1, 1000, 0}), "target beyond 24 bits rejected");
+  check(rejects({5, 0, connection::maxPackedDistance + 1, 1000, 0}), "distance beyond 8 bits rejected");
+  check(rejects({5, 0, -1, 1000, 0}), "negative distance rejected");
+  check(rejects({5, 0, 0, 1000, 0}), "0 distance rejected - due at the tick that raised it");
+  check(rejects({5, 0, 3, 30000, 10000}), "combined weight beyond int16 rejected");
+
+  // packed fan-out kernel
+  for (connection::Connection& conn : pool)
+  {
+    conn.targetNeuronSlot = (conn.targetNeuronSlot < 0) ? -1 : conn.targetNeuronSlot % 100000;
+    conn.lastSignalOriginTime = 0;
+  }
+  connection::pack(pool, hot, cold);
+  bool deliveries{true};
+  bool earliest{true};
+  std::vector<int32_t> connIds;
+  std::vector<tick::Delivery> expected;
+  std::vector<tick::Delivery> outbox;
+  for (int32_t round = 0; round < 20000; ++round)
+  {
+    connIds.resize(rng() % 71);
+    for (int32_t& connIdx : connIds)
+    {
+      connIdx = static_cast<int32_t>(rng() % pool.size());
+    }
+    int32_t clock = 1000 + round;
+    expected.assign(round % 3, tick::Delivery{-7, -7, -7, -7});
+    outbox = expected;
+    int32_t fullEarliest = fanout::collect(connIds.data(), connIds.data() + connIds.size(), pool.data(),
+                                           clock, expected);
+    int32_t packedEarliest = fanout::collect(connIds.data(), connIds.data() + connIds.size(), hot.data(), cold.data(),
+                                             clock, outbox);
+    deliveries = deliveries && sameDeliveries(expected, outbox);
+    earliest = earliest && fullEarliest == packedEarliest;
+  }
+  bool stamps{true};
+  for (std::size_t c = 0; c < pool.size(); ++c)
+  {
+    stamps = stamps && pool[c].lastSignalOriginTime == cold[c].lastSignalOriginTime;
+  }
+#ifdef __AVX2__
+  std::cout << "AVX2 kernel\n";
+#else
+  std::cout << "scalar kernel\n";
+#endif
+  check(deliveries, "packed kernel gives the same deliveries, in fan-out order");
+  check(earliest, "packed kernel gives the same earliest actionTime");
+  check(stamps, "packed kernel stamps the same lastSignalOriginTime");
+
+  // whole network, both pools
+  conns::Connections connections = conns::Connections(poolSize * fanOut + 1);
+  neurons::Neurons neurons = neurons::Neurons(poolSize);
+  std::vector<connection::Connection> fullPool;
+  std::vector<connection::Connection> packedPool;
+  std::vector<uint64_t> reference = runNetwork(neurons, connections, 1, false, fullPool);
+  for (int32_t threads : {1, 4})
+  {
+    bool ticksMatch = runNetwork(neurons, connections, threads, true, packedPool) == reference;
+    bool poolsMatch = packedPool.size() == fullPool.size();
+    for (std::size_t c = 0; poolsMatch && c < fullPool.size(); ++c)
+    {
+      poolsMatch = same(fullPool[c], packedPool[c]);
+    }
+    check(ticksMatch && poolsMatch, threads == 1 ? "packed pool ticks as the Connection pool, 1 thread"
+                                                 : "packed pool ticks as the Connection pool, 4 threads");
+  }
+  neurons.setTickThreads(1);
+
+  std::cout << "bytes per connection: " << sizeof(connection::Connection) << " -> "
+            << sizeof(connection::HotConnection) + sizeof(connection::ColdConnection) << ", fan-out reads "
+            << sizeof(connection::HotConnection) << '\n';
+  std::cout << "\nconnectionpacktest failures:= " << failures << std::endl;
+  return failures;
+}
@@ -0,0 +1,205 @@
+#include <iostream>
+#include <vector>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <sys/resource.h>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "TCNTopology.h"
+#include "NetworkBuilder.h"
+
+extern int32_t masterClock;
+extern std::vector<signal::Signal> m_srb;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief End-to-end throughput of the IT/V4/V2/V1 stack under a Poisson stimulus into V1.
+ *
+ * @details Oct 2026: the baseline every performance change is judged against. The network is
+ * the tcnconstants one - fan-out IT SixPacks per layer, default SixPacks, neuron_connection_ratio
+ * connections a neuron laid down by netbuild::buildConnectionNetwork with its fixed seed - and
+ * the ring holds neuron_signal_ratio signals a neuron. Every V1 neuron receives a
+ * cascadeThreshold stimulus as a Poisson process at the given rate, drawn tick by tick from a
+ * seeded generator, so two runs with the same arguments simulate exactly the same network
+ * activity. The clock steps one tick at a time, idle ticks included, for the simulated seconds.
+ *
+ * Reported, as one JSON document on stdout like tickbench:
+ *   sim_ms_per_wall_sec    simulated milliseconds per wall clock second, stimulus included
+ *   signals_per_sec        signals the network emitted (stimuli not counted) per wall second
+ *   cascades               per visual layer and in total
+ *   tick_ns                per tick latency of scanNeuronsForSignals: p50, p90, p99, p999, max
+ *   peak_rss_mb            the process high water mark (getrusage), build included
+ * and the build time, network size and srb live overwrites, so an undersized ring shows.
+ *
+ * usage: cortexbench [simulated seconds] [stimulus Hz] [fan-out] [tick threads] [seed] [weight]
+ *        e.g. cortexbench 1 20 3 on a small machine; the defaults are 1 s, 20 Hz, IT, 1 thread and
+ *        the BuildSpec seed and weight. At base_signal_size only V1 cascades; a larger weight
+ *        lets the activity climb the stack.
+ * Build with -DNDEBUG so tracing does not swamp the timings.
+ *
+ * @return  0 if ok; else the number of failed sanity checks
+ */
+
+using topology::VLayer;
+using benchClock = std::chrono::steady_clock;
+
+double msecsSince(benchClock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+}
+
+int64_t percentile(const std::vector<int64_t>& sorted, double fraction)
+{
+  // nearest rank
+  if (sorted.empty())
+  {
+    return 0;
+  }
+  std::size_t rank = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size()));
+  return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+int main (int argc, char* argv[])
+{
+  const double seconds = (argc > 1) ? std::atof(argv[1]) : 1.0;
+  const double stimulusHz = (argc > 2) ? std::atof(argv[2]) : 20.0;
+  const int32_t fanOut = (argc > 3) ? std::atoi(argv[3]) : tconst::IT;
+  const int32_t threads = (argc > 4) ? std::atoi(argv[4]) : 1;
+  const uint64_t seed = (argc > 5) ? std::strtoull(argv[5], nullptr, 10) : netbuild::BuildSpec{}.seed;
+  const int32_t weight = (argc > 6) ? std::atoi(argv[6]) : netbuild::BuildSpec{}.weight;
+  int32_t failures{0};
+
+  // the network
+  const topology::DynamicTopology topology(fanOut, {tconst::L1_width, tconst::L1_depth, tconst::Lx_width, tconst::Lx_depth});
+  auto start = benchClock::now();
+  conns::Connections connections = conns::Connections(1);
+  neurons::Neurons neurons = neurons::Neurons(topology);
+  m_neuronPool.resize(topology.neuronCount, INT32_MAX, -tconst::refractoryWidth - 1);
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(topology.signalCount);
+  netbuild::BuildSpec spec{};
+  spec.seed = seed;
+  spec.weight = static_cast<int16_t>(std::clamp(weight, 1, static_cast<int32_t>(INT16_MAX)));
+  int64_t built = netbuild::buildConnectionNetwork(topology, spec);
+  double buildMsecs = msecsSince(start);
+  neurons.setTickThreads(threads, 0, topology.sixPackSize);
+
+  std::array<int32_t, topology::vLayerCount + 1> layerOrigin{};
+  for (int32_t v = 0; v < topology::vLayerCount; ++v)
+  {
+    layerOrigin[v] = topology.sixPackOrigin(static_cast<VLayer>(v), 0);
+  }
+  layerOrigin[topology::vLayerCount] = topology.neuronCount;
+  const int32_t v1First = layerOrigin[static_cast<int32_t>(VLayer::V1)];
+  const int32_t v1Count = topology.neuronCount - v1First;
+
+  // the run: a Bernoulli draw per V1 neuron per tick, Poisson at stimulusHz
+  const int32_t ticks = static_cast<int32_t>(seconds * 1000.0 * tconst::ticks_per_msec);
+  const double perTick = std::min(1.0, stimulusHz / (1000.0 * tconst::ticks_per_msec));
+  std::mt19937_64 rng(seed);
+  std::geometric_distribution<int32_t> gap(perTick > 0.0 ? perTick : 1.0);
+  masterClock = 0;
+  eventWheel.reset(masterClock);
+  const srb::RingStats before = srbStats;
+
+  std::array<int64_t, topology::vLayerCount> cascades{};
+  std::vector<int64_t> tickNanos;
+  tickNanos.reserve(static_cast<std::size_t>(ticks));
+  int64_t stimuli{0};
+  int32_t busyTicks{0};
+  start = benchClock::now();
+  for (int32_t t = 0; t < ticks; ++t)
+  {
+    const int32_t clock = masterClock + 1;
+    for (int32_t n = v1First + gap(rng); perTick > 0.0 && n < topology.neuronCount; n += 1 + gap(rng))
+    {
+      int32_t slot = ring.allocateSignalSlot();
+      m_srb[slot] = srb::makeSignal(clock, 0, tconst::cascadeThreshold);
+      if (connections.enqueueSignal(n, srb::makeHandle(slot), clock))
+      {
+        eventWheel.schedule(n, clock);
+      }
+      ++stimuli;
+    }
+
+    auto tickStart = benchClock::now();
+    if (eventWheel.nextEventTime() <= clock)
+    {
+      neurons.advanceMasterClock();
+      neurons.scanNeuronsForSignals();
+      ++busyTicks;
+      for (int32_t neuronId : dueNeurons)
+      {
+        // a neuron that cascaded this tick has just started its refractory period
+        if (m_neuronPool.refractoryEnd[neuronId] == masterClock + tconst::refractoryWidth)
+        {
+          int32_t v = static_cast<int32_t>(std::upper_bound(layerOrigin.begin(), layerOrigin.end(), neuronId) -
+                                           layerOrigin.begin()) - 1;
+          ++cascades[v];
+        }
+      }
+    }
+    else
+    {
+      masterClock = clock;
+    }
+    tickNanos.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(benchClock::now() - tickStart).count());
+  }
+  double runMsecs = msecsSince(start);
+  neurons.setTickThreads(1);
+
+  int64_t totalCascades{0};
+  for (int64_t layer : cascades)
+  {
+    totalCascades += layer;
+  }
+  int64_t signals = srbStats.allocations - before.allocations - stimuli;
+  std::sort(tickNanos.begin(), tickNanos.end());
+  struct rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  double wallSecs = runMsecs / 1000.0;
+
+  std::cout << "{\n  \"context\": {\"tick_threads\": " << threads << ", \"fanout\": " << fanOut
+            << ", \"sixpack_size\": " << topology.sixPackSize << ", \"seed\": " << seed << ", \"weight\": " << spec.weight
+            << ", \"huge_pages\": " << (pools::hugePages ? "true" : "false")
+#ifdef __AVX2__
+            << ", \"avx2\": true"
+#else
+            << ", \"avx2\": false"
+#endif
+            << "},\n  \"network\": {\"neurons\": " << topology.neuronCount << ", \"v1_neurons\": " << v1Count
+            << ", \"connections\": " << built << ", \"srb_slots\": " << topology.signalCount
+            << ", \"build_ms\": " << buildMsecs << "},\n"
+            << "  \"run\": {\"simulated_ms\": " << ticks / tconst::ticks_per_msec << ", \"ticks\": " << ticks
+            << ", \"busy_ticks\": " << busyTicks << ", \"stimulus_hz\": " << stimulusHz << ", \"stimuli\": " << stimuli
+            << ", \"wall_ms\": " << runMsecs << ",\n"
+            << "          \"sim_ms_per_wall_sec\": " << ((wallSecs > 0.0) ? ticks / tconst::ticks_per_msec / wallSecs : 0.0)
+            << ", \"signals\": " << signals
+            << ", \"signals_per_sec\": " << ((wallSecs > 0.0) ? static_cast<double>(signals) / wallSecs : 0.0)
+            << ", \"srb_live_overwrites\": " << srbStats.liveOverwrites - before.liveOverwrites << ",\n"
+            << "          \"cascades\": {\"IT\": " << cascades[0] << ", \"V4\": " << cascades[1] << ", \"V2\": "
+            << cascades[2] << ", \"V1\": " << cascades[3] << ", \"total\": " << totalCascades << "},\n"
+            << "          \"tick_ns\": {\"p50\": " << percentile(tickNanos, 0.50) << ", \"p90\": " << percentile(tickNanos, 0.90)
+            << ", \"p99\": " << percentile(tickNanos, 0.99) << ", \"p999\": " << percentile(tickNanos, 0.999)
+            << ", \"max\": " << (tickNanos.empty() ? 0 : tickNanos.back()) << "},\n"
+            << "          \"peak_rss_mb\": " << static_cast<double>(usage.ru_maxrss) / 1024.0 << "}\n}" << std::endl;
+
+  // a stimulated V1 must cascade, and every emitted signal comes from a cascade
+  failures += (stimuli == 0 || cascades[static_cast<int32_t>(VLayer::V1)] > 0) ? 0 : 1;
+  failures += (signals >= 0 && (totalCascades > 0 || signals == 0)) ? 0 : 1;
+  if (failures > 0)
+  {
+    std::cerr << "cortexbench: " << failures << " sanity checks failed\n";
+  }
+  return failures;
+}
@@ -0,0 +1,127 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include "Connection.h"
+#include "TickPartitions.h"
+#include "FanOutKernel.h"
+#include "Learning.h"
+#include "TestCheck.h"
+
+/**
+ * @brief The batched fan-out kernel gives exactly what the connection by connection loop gave.
+ *
+ * @details Random fan-outs of 0 to 70 connections - full batches and every length of tail - are
+ * drawn from a pool with empty proto connections (target -1) and weights over the whole int16
+ * range; every connection with a target is live. For each one the kernel's
+ * Deliveries, earliest actionTime and lastSignalOriginTime stamps must match the reference loop,
+ * and so must the weights: the clock runs far enough past the stamps for the lazy stp/ltp decay.
+ * Build with and without -mavx2 to cover both paths.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+int32_t reference(const std::vector<int32_t>& fanOut, std::vector<connection::Connection>& pool,
+                  int32_t clock, std::vector<tick::Delivery>& outbox)
+{
+  // Connections::collectOutgoingSignals' connection by connection loop
+  int32_t earliest{INT32_MAX};
+  for (int32_t connIdx : fanOut)
+  {
+    connection::Connection& conn = pool[connIdx];
+    if (conn.targetNeuronSlot >= 0)
+    {
+      if (learning::due(clock, conn.lastSignalOriginTime))
+      {
+        learning::age(conn, clock);     // lazy stp/ltp decay
+      }
+      conn.lastSignalOriginTime = clock;
+      outbox.push_back(tick::Delivery{connIdx, conn.targetNeuronSlot, clock + conn.temporalDistanceToTarget,
+                                      static_cast<int16_t>(conn.stpWeight + conn.ltpWeight)});
+      earliest = (outbox.back().actionTime < earliest) ? outbox.back().actionTime : earliest;
+    }
+  }
+  return earliest;
+}
+
+bool sameDeliveries(const std::vector<tick::Delivery>& a, const std::vector<tick::Delivery>& b)
+{
+  if (a.size() != b.size())
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    if (a[i].connId != b[i].connId || a[i].target != b[i].target ||
+        a[i].actionTime != b[i].actionTime || a[i].amplitude != b[i].amplitude)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main ()
+{
+  constexpr int32_t poolSize{5000};
+  constexpr int32_t rounds{20000};
+  std::mt19937 rng(20261017);
+
+  std::vector<connection::Connection> pool(poolSize);
+  for (connection::Connection& conn : pool)
+  {
+    conn.targetNeuronSlot = (rng() % 10 == 0) ? -1 : static_cast<int32_t>(rng() % 100000);
+    conn.lastSignalOriginTime = 0;
+    conn.temporalDistanceToTarget = static_cast<int32_t>(rng() % 40);
+    conn.stpWeight = static_cast<int16_t>(rng());
+    conn.ltpWeight = static_cast<int16_t>(rng());
+  }
+  std::vector<connection::Connection> kernelPool = pool;
+
+  bool deliveries{true};
+  bool earliest{true};
+  bool stamps{true};
+  int64_t collected{0};
+  std::vector<int32_t> fanOut;
+  std::vector<tick::Delivery> expected;
+  std::vector<tick::Delivery> outbox;
+  for (int32_t round = 0; round < rounds; ++round)
+  {
+    fanOut.resize(rng() % 71);
+    for (int32_t& connIdx : fanOut)
+    {
+      connIdx = static_cast<int32_t>(rng() % poolSize);
+    }
+    int32_t clock = 1000 + round;
+
+    // both append to what is already there
+    expected.assign(round % 3, tick::Delivery{-7, -7, -7, -7});
+    outbox = expected;
+    int32_t expectedEarliest = reference(fanOut, pool, clock, expected);
+    int32_t kernelEarliest = fanout::collect(fanOut.data(), fanOut.data() + fanOut.size(),
+                                             kernelPool.data(), clock, outbox);
+
+    deliveries = deliveries && sameDeliveries(expected, outbox);
+    earliest = earliest && expectedEarliest == kernelEarliest;
+    collected += static_cast<int64_t>(outbox.size());
+  }
+  for (int32_t c = 0; c < poolSize; ++c)
+  {
+    stamps = stamps && pool[c].lastSignalOriginTime == kernelPool[c].lastSignalOriginTime &&
+             pool[c].stpWeight == kernelPool[c].stpWeight && pool[c].ltpWeight == kernelPool[c].ltpWeight;
+  }
+
+#ifdef __AVX2__
+  std::cout << "AVX2 kernel: ";
+#else
+  std::cout << "scalar kernel: ";
+#endif
+  std::cout << collected << " deliveries from " << rounds << " fan-outs\n";
+  check(deliveries, "same deliveries, in fan-out order");
+  check(earliest, "same earliest actionTime");
+  check(stamps, "same lastSignalOriginTime stamps and aged weights");
+
+  std::cout << "\nfanoutkerneltest failures:= " << failures << std::endl;
+  return failures;
+}
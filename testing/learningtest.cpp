@@ -0,0 +1,239 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "FanOutKernel.h"
+#include "Learning.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern std::vector<connection::HotConnection> m_connHot;
+extern std::vector<connection::ColdConnection> m_connCold;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief STP/LTP group strengthening and its lazy decay.
+ *
+ * @details Strengthening an excitatory and an inhibitory connection walks stp up to
+ * stp_signal_limit and then ltp up to its limit, and no further. Decay is checked through the
+ * fan-out kernel: nothing happens within a decay interval of the last signal, whole intervals
+ * come off when the connection is next used and the signal carries the decayed amplitude. A
+ * connection reused far more often than once a decay interval must still decay, by exactly the
+ * units a single use at the end would take off. The
+ * packed pool must learn exactly as the Connection pool, through learning:: and through
+ * Connections::strengthen. Finally a random network is run with one and with four threads: the
+ * cascades must have strengthened connections, identically for both, and connections that never
+ * signalled must not have been touched.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+constexpr int32_t sixPacks{12};
+constexpr int32_t poolSize{sixPacks * tconst::sixpack_size};
+constexpr int32_t fanOut{12};
+constexpr int32_t ticks{300};
+
+bool same(const connection::Connection& a, const connection::Connection& b)
+{
+  return a.targetNeuronSlot == b.targetNeuronSlot && a.lastSignalOriginTime == b.lastSignalOriginTime &&
+         a.temporalDistanceToTarget == b.temporalDistanceToTarget && a.stpWeight == b.stpWeight &&
+         a.ltpWeight == b.ltpWeight;
+}
+
+bool strengthensTo(int16_t base)
+{
+  connection::Connection conn{1, 0, 1, base, 0};
+  int32_t sign = (base < 0) ? -1 : 1;
+  bool ok{true};
+  for (int32_t pulse = 1; pulse <= 10; ++pulse)
+  {
+    learning::strengthen(conn);
+    ok = ok && conn.stpWeight == sign * (tconst::base_signal_size + pulse * tconst::stp_units_per_tetanic_pulse) &&
+         conn.ltpWeight == 0;
+  }
+  for (int32_t pulse = 0; pulse < 800; ++pulse)
+  {
+    learning::strengthen(conn);
+  }
+  return ok && conn.stpWeight == sign * tconst::stp_signal_limit &&
+         conn.ltpWeight == sign * (tconst::ltp_signal_limit - tconst::base_signal_size);
+}
+
+int16_t fire(std::vector<connection::Connection>& pool, int32_t clock)
+{
+  // one connection's fan-out through the kernel; the amplitude it signalled with
+  std::vector<tick::Delivery> outbox;
+  int32_t connId{1};
+  fanout::collect(&connId, &connId + 1, pool.data(), clock, outbox);
+  return outbox.empty() ? INT16_MIN : outbox.front().amplitude;
+}
+
+std::vector<connection::Connection> runNetwork(neurons::Neurons& neurons, conns::Connections& connections,
+                                               int32_t threads, int64_t& strengthened)
+{
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(20000);
+  m_neuronPool.resize(poolSize, INT32_MAX, -tconst::refractoryWidth - 1);
+  neurons.setTickThreads(threads);
+  masterClock = 0;
+  eventWheel.reset(masterClock);
+
+  std::mt19937 rng(20261017);
+  int32_t conn{1};
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    for (int32_t f = 0; f < fanOut; ++f, ++conn)
+    {
+      int32_t target = static_cast<int32_t>(rng() % poolSize);
+      int16_t weight = static_cast<int16_t>(tconst::base_signal_size * (4 + rng() % 9));
+      m_connPool[conn] = connection::Connection{target, 0, 1 + static_cast<int32_t>(rng() % 12), weight, 0};
+      m_neuronPool.addOutgoing(n, conn);
+    }
+  }
+  m_neuronPool.buildOutgoingIndex();
+  std::vector<connection::Connection> built = m_connPool;
+
+  for (int32_t i = 0; i < poolSize / 8; ++i)
+  {
+    int32_t target = static_cast<int32_t>(rng() % poolSize);
+    int32_t slot = ring.allocateSignalSlot();
+    m_srb[slot] = srb::makeSignal(1 + static_cast<int32_t>(rng() % 20), 0, tconst::cascadeThreshold);
+    if (connections.enqueueSignal(target, srb::makeHandle(slot), srb::actionTime(m_srb[slot])))
+    {
+      eventWheel.schedule(target, srb::actionTime(m_srb[slot]));
+    }
+  }
+  for (int32_t t = 0; t < ticks && neurons.advanceMasterClock() != INT32_MAX; ++t)
+  {
+    neurons.scanNeuronsForSignals();
+  }
+
+  strengthened = 0;
+  bool untouched{true};
+  for (std::size_t c = 0; c < built.size(); ++c)
+  {
+    bool signalled = m_connPool[c].lastSignalOriginTime != built[c].lastSignalOriginTime;
+    bool learned = m_connPool[c].stpWeight != built[c].stpWeight || m_connPool[c].ltpWeight != built[c].ltpWeight;
+    strengthened += learned ? 1 : 0;
+    untouched = untouched && (signalled || !learned);
+  }
+  check(untouched, "connections that never signalled were never strengthened");
+  return m_connPool;
+}
+
+int main ()
+{
+  // strengthening
+  check(strengthensTo(tconst::base_signal_size), "excitatory: stp to its limit, then ltp to its limit");
+  check(strengthensTo(-tconst::base_signal_size), "inhibitory: the same with the sign kept");
+
+  // lazy decay through the fan-out
+  const int16_t fullStp{tconst::stp_signal_limit};
+  const int16_t fullLtp{tconst::ltp_signal_limit - tconst::base_signal_size};
+  std::vector<connection::Connection> pool(2, connection::Connection{-1, -1, -1, -1, -1});
+  pool[1] = connection::Connection{7, 0, 3, fullStp, fullLtp};
+  int16_t amplitude = fire(pool, tconst::stp_unit_decay_interval - 1);
+  check(amplitude == fullStp + fullLtp && pool[1].stpWeight == fullStp && pool[1].ltpWeight == fullLtp,
+        "no decay within a decay interval");
+  int32_t last = pool[1].lastSignalOriginTime;
+  int32_t later = last + 10 * tconst::stp_unit_decay_interval;
+  amplitude = fire(pool, later);
+  int32_t ltpUnits = later / tconst::ltp_unit_decay_interval - last / tconst::ltp_unit_decay_interval;
+  check(pool[1].stpWeight == fullStp - 10 && pool[1].ltpWeight == fullLtp - ltpUnits &&
+        amplitude == pool[1].stpWeight + pool[1].ltpWeight, "whole intervals decay when next used");
+
+  // reuse faster than a decay interval still decays, exactly as one use at the end would
+  std::vector<connection::Connection> busy(2, connection::Connection{-1, -1, -1, -1, -1});
+  std::vector<connection::Connection> idle = busy;
+  busy[1] = connection::Connection{7, 0, 3, fullStp, fullLtp};
+  idle[1] = busy[1];
+  constexpr int32_t reuseEvery{100};
+  constexpr int32_t reuseUntil{10 * tconst::ltp_unit_decay_interval};
+  for (int32_t clock = reuseEvery; clock <= reuseUntil; clock += reuseEvery)
+  {
+    fire(busy, clock);
+  }
+  fire(idle, busy[1].lastSignalOriginTime);
+  int32_t end = busy[1].lastSignalOriginTime;
+  check(busy[1].stpWeight == fullStp - end / tconst::stp_unit_decay_interval &&
+        busy[1].ltpWeight == fullLtp - end / tconst::ltp_unit_decay_interval && busy[1].ltpWeight < fullLtp,
+        "a connection reused every 100 ticks still decays, stp and ltp");
+  check(same(busy[1], idle[1]), "frequent use decays exactly as one use after the same time");
+
+  amplitude = fire(pool, pool[1].lastSignalOriginTime + tconst::ltp_decay_time);
+  check(pool[1].stpWeight == tconst::base_signal_size && pool[1].ltpWeight == 0 &&
+        amplitude == tconst::base_signal_size, "decay stops at the base signal size");
+
+  // packed pool learns as the Connection pool
+  std::mt19937 rng(20261017);
+  bool packedSame{true};
+  for (int32_t round = 0; round < 2000; ++round)
+  {
+    int16_t stp = static_cast<int16_t>((rng() % 2 ? 1 : -1) * (tconst::base_signal_size + rng() % 1001));
+    connection::Connection conn{5, 0, 2, stp, static_cast<int16_t>((stp < 0 ? -1 : 1) * (rng() % 3000))};
+    connection::HotConnection hot = connection::packHot(conn);
+    connection::ColdConnection cold = connection::packCold(conn);
+    int32_t clock{0};
+    for (int32_t step = 0; step < 50; ++step)
+    {
+      if (rng() % 3 == 0)
+      {
+        clock += static_cast<int32_t>(rng() % 20000);
+        if (learning::due(clock, conn.lastSignalOriginTime))
+        {
+          packedSame = packedSame && learning::age(conn, clock) == learning::age(hot, cold, clock);
+        }
+        conn.lastSignalOriginTime = clock;
+        cold.lastSignalOriginTime = clock;
+      }
+      else
+      {
+        learning::strengthen(conn);
+        learning::strengthen(hot, cold);
+      }
+      packedSame = packedSame && same(conn, connection::unpack(hot, cold));
+    }
+  }
+  check(packedSame, "packed records strengthen and decay as Connection records");
+
+  conns::Connections connections = conns::Connections(poolSize * fanOut + 1);
+  neurons::Neurons neurons = neurons::Neurons(poolSize);
+  m_connPool[3] = connection::Connection{4, 0, 2, tconst::base_signal_size, 0};
+  m_connPool[4] = m_connPool[3];
+  connections.strengthen(3);
+  connections.packPool();
+  connections.strengthen(3);
+  connections.strengthen(0);
+  connections.unpackPool();
+  check(m_connPool[3].stpWeight == tconst::base_signal_size + 2 * tconst::stp_units_per_tetanic_pulse &&
+        same(m_connPool[4], connection::Connection{4, 0, 2, tconst::base_signal_size, 0}) &&
+        m_connPool[0].stpWeight == -1, "Connections::strengthen on either pool, proto connection skipped");
+
+  // cascades strengthen their contributors
+  int64_t serialCount{0};
+  int64_t parallelCount{0};
+  std::vector<connection::Connection> serial = runNetwork(neurons, connections, 1, serialCount);
+  std::vector<connection::Connection> parallel = runNetwork(neurons, connections, 4, parallelCount);
+  bool poolsMatch = serial.size() == parallel.size();
+  for (std::size_t c = 0; poolsMatch && c < serial.size(); ++c)
+  {
+    poolsMatch = same(serial[c], parallel[c]);
+  }
+  std::cout << serialCount << " connections strengthened\n";
+  check(serialCount > 0, "cascades strengthened their contributing connections");
+  check(poolsMatch, "four threads learn exactly as one");
+  neurons.setTickThreads(1);
+
+  std::cout << "\nlearningtest failures:= " << failures << std::endl;
+  return failures;
+}
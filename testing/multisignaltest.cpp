@@ -2,6 +2,7 @@
 #include <vector>
 #include <climits>
 #include <cstdint>
+#include <chrono>
 #include "Connections.h"
 #include "Connection.h"
 #include "Signal.h"
@@ -23,7 +24,7 @@ extern std::vector<signal::Signal> m_srb;
 extern int32_t currentSignalSlot;
 extern int32_t signalBufferCapacity;
 
-extern std::vector<neuron::Neuron> m_neuronPool;
+extern neuron::NeuronPool m_neuronPool;
 extern int32_t currentNeuronSlot;
 extern int32_t neuronPoolCapacity;
 
@@ -40,7 +41,6 @@ int main  ()
   void outDetails(int32_t); // shorthand for print outgoing details.
   void inDetails(int32_t);  // shorthand for print incoming details
   int32_t nonRef(int32_t);  // look for non refractory neurons
-  int32_t nonRNeurons{0};   // non refractory neurons count
 
   int32_t allocateASignalSlot(int32_t);  // ok to use during testing
   /**
@@ -84,16 +84,6 @@ int main  ()
 
 
 
-    // Indexes into pools
-    int32_t cIdx;
-    int32_t nIdx;
-    int32_t sIdx;
-
-    // Trackers for ranges
-    int32_t connSlot{};
-    int32_t neuronSlot{};
-    int32_t signalSlot{};
-
     int32_t nextSignalSlot; // used for signal allocation
 
 
@@ -144,7 +134,6 @@ int main  ()
 
    // scan neurons lookin for non-refractory
    std::cout << "\nScan looking for non-refractory Neurons\n";
-  // nonRNeurons =  nonRef(0);
 
 
   std::cout << "\nFound:= " << std::to_string(nonRef(0)) << " non-refractory neurons\n";
@@ -153,11 +142,8 @@ int main  ()
     std::cout << "\nEmpty neuron 0";
     prtN(0);
 
-    std::cout << "\nZero outgoing slot in n[0]\n";
-    cObj.printConnectionFromIndex(m_neuronPool[0].outgoingSignals[0]);
-
-    std::cout << "\nNeuron outgoing before any pushes\n";
-    for (int32_t cIdx : m_neuronPool[0].outgoingSignals)
+    std::cout << "\nNeuron outgoing before any pushes - should be empty\n";
+    for (int32_t cIdx : m_neuronPool.outgoing(0))
     {
       cObj.printConnectionFromIndex(cIdx);
     }
@@ -166,17 +152,19 @@ int main  ()
     // n[0] when it cascades will produce a train of 5 signals all aimed at n[9]
     // n[9] should see 5 incoming signals with 1 clock tick of each other
 
-    // Leave outsig[0] pointing to conn[0]
+    // Oct 2026: neurons no longer start with a proto outgoing entry, so n[0] gets conn[0] explicitly
  
-    m_neuronPool[0].outgoingSignals.push_back(1);
-    m_neuronPool[0].outgoingSignals.push_back(2);
-    m_neuronPool[0].outgoingSignals.push_back(3);
-    m_neuronPool[0].outgoingSignals.push_back(4);
-    m_neuronPool[0].outgoingSignals.push_back(5);
-
-    m_neuronPool[9].outgoingSignals.push_back(9);
-    m_neuronPool[10].outgoingSignals.push_back(10);
-    m_neuronPool[11].outgoingSignals.push_back(11);
+    m_neuronPool.addOutgoing(0, 0);
+    m_neuronPool.addOutgoing(0, 1);
+    m_neuronPool.addOutgoing(0, 2);
+    m_neuronPool.addOutgoing(0, 3);
+    m_neuronPool.addOutgoing(0, 4);
+    m_neuronPool.addOutgoing(0, 5);
+
+    m_neuronPool.addOutgoing(9, 9);
+    m_neuronPool.addOutgoing(10, 10);
+    m_neuronPool.addOutgoing(11, 11);
+    m_neuronPool.buildOutgoingIndex();   // compress the staged fan-out into the CSR arrays
 
   // let's see the neuron structure.
     prtN(0); 
@@ -190,15 +178,14 @@ int main  ()
 
   // have to set this signal into srb as neuron incoming uses index into srb to retrieve signals
     nextSignalSlot = allocateASignalSlot(0);
-    m_srb[nextSignalSlot].actionTime = masterClock;
-    m_srb[nextSignalSlot].amplitude = tconst::cascadeThreshold + 1;
-    m_srb[nextSignalSlot].owner = 0;  // this is where we are going to push this cascading signal
-    m_srb[nextSignalSlot].testId = 0;
+    m_srb[nextSignalSlot] = srb::makeSignal(masterClock, 0, tconst::cascadeThreshold + 1);
 
-    m_neuronPool[0].incomingSignals.push_back(nextSignalSlot);
+    m_neuronPool.incomingSignals[0].push_back(srb::makeHandle(nextSignalSlot));
     // having set a signal my hand, we should update the nextEvent time for this neuron
     // vector.back() returns a reference to the last slot in the vector
-    m_neuronPool[0].nextEvent = m_srb[ m_neuronPool[0].incomingSignals.back() ].actionTime;
+    m_neuronPool.nextEvent[0] = srb::actionTime(m_srb[ srb::handleSlot(m_neuronPool.incomingSignals[0].back()) ]);
+    // the scan only visits neurons the event wheel has due, so schedule n[0] by hand as well
+    eventWheel.schedule(0, m_neuronPool.nextEvent[0]);
 
     std::cout << "\nOpening MasterClock:= " << std::to_string(masterClock);
     globalNextEvent = INT32_MAX;  // Any signal will set this to a lower clock value
@@ -210,8 +197,8 @@ int main  ()
 
     // ensure n[0] and n[9] are not marked refractory as this would prevent processing
     // If masterClock is at 0 this sets them to -1 which is before current master clock so they are non-refractory
-    m_neuronPool[0].refractoryEnd = masterClock - 1;
-    m_neuronPool[9].refractoryEnd = masterClock - 1;
+    m_neuronPool.refractoryEnd[0] = masterClock - 1;
+    m_neuronPool.refractoryEnd[9] = masterClock - 1;
 
     // all the connections in [0] point at n[9]
 
@@ -241,6 +228,37 @@ int main  ()
     std::cout << "\nmasterClock and globalNextEvent\n" << std::to_string(masterClock) <<
                   " : " << globalNextEvent;
 
+  // Oct 2026: trace cost benchmark.
+  // Re-run the n[0] -> n[9] -> n[12] cascade many times and time it. Build it twice to compare:
+  //    g++ -O2 -I ../include multisignaltest.cpp              debug trace - today's output
+  //    g++ -O2 -DNDEBUG -I ../include multisignaltest.cpp     production - tracing compiled out
+  // Run with stdout redirected to a file or /dev/null so the terminal is not what gets measured.
+
+  constexpr int32_t benchRuns{500};
+  auto benchStart = std::chrono::steady_clock::now();
+
+  for (int32_t run = 0; run < benchRuns; ++run)
+  {
+    // let everything pending from the last cascade play out
+    while (nObj.advanceMasterClock() != INT32_MAX)
+    {
+      nObj.scanNeuronsForSignals();
+    }
+    masterClock += tconst::refractoryWidth + 1;   // n[0] is out of refractory again
+
+    nextSignalSlot = allocateASignalSlot(0);
+    m_srb[nextSignalSlot] = srb::makeSignal(masterClock, 0, tconst::cascadeThreshold + 1);
+    m_neuronPool.incomingSignals[0].push_back(srb::makeHandle(nextSignalSlot));
+    m_neuronPool.nextEvent[0] = masterClock;
+    eventWheel.schedule(0, masterClock);
+
+    nObj.scanNeuronsForSignals();
+  }
+
+  double benchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - benchStart).count();
+  std::cerr << "\nTrace level " << trace::traceLevel << ": " << benchRuns << " cascade runs took "
+            << benchSeconds * 1000.0 << " msecs\n";
+
   // std::cout << "\nOutgoing details for n[0]\n";
 
   // outDetails(0);  // outgoingSignal details for n[0]
@@ -262,19 +280,19 @@ void prtN(int32_t nIdx)
 }
 void outDetails(int32_t nIdx)
 {
-  for (int32_t cIdx : m_neuronPool[nIdx].outgoingSignals)
+  for (int32_t cIdx : m_neuronPool.outgoing(nIdx))
   {
     cObj.printConnectionFromIndex(cIdx);
   }
 }
 void inDetails(int32_t nIdx)
 {
-  for (int32_t sIdx : m_neuronPool[nIdx].incomingSignals)
+  for (srb::SignalHandle sHandle : m_neuronPool.incomingSignals[nIdx])
   {
-    sObj.printSignalFromIndex(sIdx);
+    sObj.printSignalFromIndex(srb::handleSlot(sHandle));
   }
 }
-int32_t allocateASignalSlot(int32_t i)
+int32_t allocateASignalSlot(int32_t)
 {
   // fake unused input param
   // ok to use a function during testing
@@ -291,18 +309,16 @@ int32_t allocateASignalSlot(int32_t i)
   }  
 
 }
-int32_t nonRef(int32_t i)
+int32_t nonRef(int32_t)
 {
   int32_t nonR{0};
-  int32_t neuronIdx{-1};
-  for (neuron::Neuron nref : m_neuronPool)
+  for (int32_t neuronIdx = 0; neuronIdx < m_neuronPool.size(); ++neuronIdx)
   { 
-    ++neuronIdx;
-    if (nref.refractoryEnd < 10000)
+    if (m_neuronPool.refractoryEnd[neuronIdx] < 10000)
     {
       ++nonR;
       std::cout << "\nNeuronIdx:= " << std::to_string(neuronIdx);
-      nObj.printNeuronFromRef(nref);
+      nObj.printNeuronFromIndex(neuronIdx);
     }
 
   }
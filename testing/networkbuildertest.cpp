@@ -0,0 +1,233 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <chrono>
+#include <algorithm>
+#include <tuple>
+#include <stdexcept>
+#include "Connections.h"
+#include "Connection.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "TCNTopology.h"
+#include "NetworkBuilder.h"
+#include "TestCheck.h"
+
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief The seeded network builders lay down the same, well formed network for any thread count.
+ *
+ * @details A fan-out 3 network of default SixPacks (120 SixPacks, 15840 neurons) is built with
+ * one thread and with several; the connection pool and CSR fan-out must be identical. Every
+ * connection is then checked against its family's rule using the topology coordinates of source
+ * and target, its distance against the family's distance plus jitter, and the inhibitory share
+ * against the inhibition ratio. Building the five families one builder at a time must give every
+ * neuron the same connections as the single pass. A different seed must give a different
+ * network. Oct 2026: a family distance a signal cannot carry (beyond srb::maxSignalDistance) must
+ * be refused by the builder, and a hand made connection that far must be refused when it fires.
+ * The build time of the default topology is printed, not checked.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+using topology::VLayer;
+using netbuild::Family;
+
+uint64_t fold(uint64_t digest, int64_t value)
+{
+  // FNV-1a over the value's bytes
+  for (int i = 0; i < 8; ++i)
+  {
+    digest ^= static_cast<uint64_t>(value >> (8 * i)) & 0xFF;
+    digest *= 1099511628211ULL;
+  }
+  return digest;
+}
+
+uint64_t networkDigest()
+{
+  uint64_t digest{14695981039346656037ULL};
+  for (int32_t offset : m_neuronPool.outgoingOffsets)
+  {
+    digest = fold(digest, offset);
+  }
+  for (int32_t connIdx : m_neuronPool.outgoingSignals)
+  {
+    const connection::Connection& c = m_connPool[connIdx];
+    digest = fold(digest, connIdx);
+    digest = fold(digest, c.targetNeuronSlot);
+    digest = fold(digest, c.temporalDistanceToTarget);
+    digest = fold(digest, c.stpWeight);
+  }
+  return digest;
+}
+
+void emptyNetwork(int32_t neuronCount)
+{
+  m_neuronPool.resize(neuronCount, INT32_MAX, -tconst::refractoryWidth - 1);
+  m_connPool.assign(1, connection::Connection{-1, -1, -1, -1, -1});
+  currentConnectionSlot = 0;
+}
+
+bool follows(const topology::DynamicTopology& topology, Family family, int32_t source, int32_t target)
+{
+  // the family's rule, straight from the coordinates
+  topology::NeuronCoord s = topology.locate(source);
+  topology::NeuronCoord t = topology.locate(target);
+  int32_t sv = static_cast<int32_t>(s.vLayer);
+  int32_t tv = static_cast<int32_t>(t.vLayer);
+  bool samePack = sv == tv && s.sixPack == t.sixPack;
+  switch (family)
+  {
+    case Family::ForwardVerticalBranched:      return tv == sv - 1 && t.sixPack == s.sixPack / topology.fanOut;
+    case Family::BackwardVerticalBranched:     return tv == sv + 1 && t.sixPack / topology.fanOut == s.sixPack;
+    case Family::ForwardVerticalInterconnect:  return samePack && t.packLayer == s.packLayer + 1;
+    case Family::BackwardVerticalInterconnect: return samePack && t.packLayer == s.packLayer - 1;
+    case Family::HorizontalInterconnect:       return samePack && t.packLayer == s.packLayer && target != source;
+  }
+  return false;
+}
+
+std::vector<std::vector<std::tuple<int32_t, int32_t, int16_t>>> rows(int32_t neuronCount)
+{
+  // every neuron's connections as a sorted list, ignoring pool slots and order
+  std::vector<std::vector<std::tuple<int32_t, int32_t, int16_t>>> all(neuronCount);
+  for (int32_t n = 0; n < neuronCount; ++n)
+  {
+    for (int32_t connIdx : m_neuronPool.outgoing(n))
+    {
+      const connection::Connection& c = m_connPool[connIdx];
+      all[n].emplace_back(c.targetNeuronSlot, c.temporalDistanceToTarget, c.stpWeight);
+    }
+    std::sort(all[n].begin(), all[n].end());
+  }
+  return all;
+}
+
+int main ()
+{
+  const topology::DynamicTopology topology(3, {tconst::L1_width, tconst::L1_depth, tconst::Lx_width, tconst::Lx_depth});
+  const int32_t neuronCount = topology.neuronCount;
+  const netbuild::BuildSpec spec{};
+  const std::array<int32_t, netbuild::familyCount> shares = netbuild::familyShares(spec);
+
+  neurons::Neurons neurons = neurons::Neurons(topology);
+  conns::Connections connections = conns::Connections(1);
+
+  // the same network for any thread count
+  emptyNetwork(neuronCount);
+  tickWorkers.resize(1);
+  int64_t built = netbuild::buildConnectionNetwork(topology, spec);
+  uint64_t serial = networkDigest();
+  bool same{true};
+  for (int32_t threads : {2, 3, 8})
+  {
+    emptyNetwork(neuronCount);
+    tickWorkers.resize(threads);
+    same = same && netbuild::buildConnectionNetwork(topology, spec) == built && networkDigest() == serial;
+  }
+  std::cout << built << " connections for " << neuronCount << " neurons\n";
+  check(same, "1, 2, 3 and 8 threads build the same network");
+  check(currentConnectionSlot == built && static_cast<int64_t>(m_connPool.size()) == built + 1 &&
+        static_cast<int64_t>(m_neuronPool.outgoingSignals.size()) == built, "pool grown to fit, slots after the proto");
+
+  // every connection obeys its family
+  bool rules{true};
+  bool counts{true};
+  bool distances{true};
+  int64_t inhibitory{0};
+  for (int32_t n = 0; n < neuronCount; ++n)
+  {
+    const int32_t* connIdx = m_neuronPool.outgoing(n).begin();
+    int32_t expected{0};
+    for (int32_t f = 0; f < netbuild::familyCount; ++f)
+    {
+      const netbuild::FamilySpec& family = spec.families[f];
+      if (netbuild::candidates(topology, static_cast<Family>(f), topology.locate(n)).count == 0)
+      {
+        continue;
+      }
+      expected += shares[f];
+      for (int32_t k = 0; k < shares[f]; ++k, ++connIdx)
+      {
+        const connection::Connection& c = m_connPool[*connIdx];
+        rules = rules && follows(topology, static_cast<Family>(f), n, c.targetNeuronSlot);
+        distances = distances && c.temporalDistanceToTarget >= family.distance &&
+                    c.temporalDistanceToTarget < family.distance + tconst::distance_jitter;
+        inhibitory += (c.stpWeight < 0) ? 1 : 0;
+      }
+    }
+    counts = counts && static_cast<int32_t>(m_neuronPool.outgoing(n).size()) == expected;
+  }
+  double inhibitoryShare = static_cast<double>(inhibitory) / static_cast<double>(built);
+  std::cout << "inhibitory share " << inhibitoryShare << '\n';
+  check(counts, "every neuron gets the shares of the families it has candidates for");
+  check(rules, "every target is where its family says");
+  check(distances, "temporal distances are the family distance plus jitter");
+  check(inhibitoryShare > 0.39 && inhibitoryShare < 0.41, "inhibitory share matches the inhibition ratio");
+
+  // one builder at a time gives every neuron the same connections
+  auto together = rows(neuronCount);
+  emptyNetwork(neuronCount);
+  int64_t separately = netbuild::buildForwardVerticalBranched(topology, spec) +
+                       netbuild::buildBackwardVerticalBranched(topology, spec) +
+                       netbuild::buildForwardVerticalInterconnect(topology, spec) +
+                       netbuild::buildBackwardVerticalInterconnect(topology, spec) +
+                       netbuild::buildHorizontalInterconnect(topology, spec);
+  check(separately == built && rows(neuronCount) == together, "the five builders together equal buildConnectionNetwork");
+
+  netbuild::BuildSpec reseeded = spec;
+  reseeded.seed += 1;
+  emptyNetwork(neuronCount);
+  netbuild::buildConnectionNetwork(topology, reseeded);
+  check(networkDigest() != serial, "another seed builds another network");
+
+  // temporal distances a signal cannot carry
+  netbuild::BuildSpec tooFar = spec;
+  tooFar.families[static_cast<int32_t>(Family::HorizontalInterconnect)].distance = srb::maxSignalDistance;
+  emptyNetwork(neuronCount);
+  bool refused{false};
+  try
+  {
+    netbuild::buildConnectionNetwork(topology, tooFar);
+  }
+  catch (const std::invalid_argument&)
+  {
+    refused = true;
+  }
+  check(refused && currentConnectionSlot == 0, "a family distance beyond maxSignalDistance, with jitter, is refused");
+
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(64);
+  m_connPool.push_back(connection::Connection{1, 0, srb::maxSignalDistance + 1, tconst::base_signal_size, 0});
+  m_neuronPool.addOutgoing(0, 1);
+  m_neuronPool.buildOutgoingIndex();
+  refused = false;
+  try
+  {
+    connections.generateOutGoingSignals(0);
+  }
+  catch (const std::out_of_range&)
+  {
+    refused = true;
+  }
+  check(refused && m_neuronPool.incomingSignals[1].empty(), "a hand made connection beyond maxSignalDistance does not emit");
+
+  // the tcnconstants network, for scale
+  const topology::DefaultTopology defaultTopology{};
+  neurons::Neurons full = neurons::Neurons(defaultTopology);
+  emptyNetwork(defaultTopology.neuronCount);
+  tickWorkers.resize(0);
+  auto start = std::chrono::steady_clock::now();
+  int64_t fullBuilt = netbuild::buildConnectionNetwork(defaultTopology);
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << "default topology: " << fullBuilt << " connections in " << elapsed.count()
+            << " msecs on " << tickWorkers.size() << " threads\n";
+
+  std::cout << "\nnetworkbuildertest failures:= " << failures << std::endl;
+  return failures;
+}
@@ -0,0 +1,153 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <new>
+#include "Connections.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+
+extern int32_t masterClock;
+extern std::vector<signal::Signal> m_srb;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Count the heap allocations made while visiting a 100k neuron pool.
+ * 
+ * @details Compares the old by-value visit, which deep copied every neuron's queue, with
+ * in-place access, then runs the real scan with every neuron due so the purge runs too.
+ * Every neuron carries a queue of 8 signals.
+ * 
+ * Build with -DNDEBUG so tracing does not swamp the timings.
+ */
+
+static std::int64_t heapAllocations{0};
+
+void* operator new(std::size_t size)
+{
+  ++heapAllocations;
+  if (void* p = std::malloc(size ? size : 1)) { return p; }
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using benchClock = std::chrono::steady_clock;
+
+double msecsSince(benchClock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+}
+
+int main ()
+{
+  constexpr int32_t poolSize{100000};
+  constexpr int32_t signalsPerNeuron{8};
+
+  srb::SignalRingBuffer srb = srb::SignalRingBuffer(poolSize * signalsPerNeuron + 1);
+  conns::Connections connections = conns::Connections(1000);
+  neurons::Neurons neurons = neurons::Neurons(poolSize);
+
+  masterClock = 1000;
+  eventWheel.reset(masterClock);
+
+  int32_t slot{0};
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    m_neuronPool.refractoryEnd[n] = 0;
+    m_neuronPool.nextEvent[n] = masterClock;
+    for (int32_t s = 0; s < signalsPerNeuron; ++s)
+    {
+      ++slot;
+      m_srb[slot] = srb::makeSignal(masterClock - 20 + s, 0, 100);     // all stale - purge will drop them
+      m_neuronPool.incomingSignals[n].push_back(srb::makeHandle(slot));
+    }
+  }
+
+  // old pattern: every neuron's queue deep-copied
+  std::int64_t visited{0};
+  std::int64_t before = heapAllocations;
+  auto start = benchClock::now();
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    arena::SignalQueue queue = m_neuronPool.incomingSignals[n];
+    std::vector<int32_t> incomingSignals(queue.begin(), queue.end());
+    visited += static_cast<std::int64_t>(incomingSignals.size());
+  }
+  double byValueMsecs = msecsSince(start);
+  std::int64_t byValueAllocs = heapAllocations - before;
+
+  // in-place access
+  before = heapAllocations;
+  start = benchClock::now();
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    arena::SignalQueue incomingSignals = m_neuronPool.incomingSignals[n];
+    visited += static_cast<std::int64_t>(incomingSignals.size());
+  }
+  double byRefMsecs = msecsSince(start);
+  std::int64_t byRefAllocs = heapAllocations - before;
+
+  // the real scan with every neuron due
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    eventWheel.schedule(n, masterClock);
+  }
+  dueNeurons.reserve(poolSize);
+  before = heapAllocations;
+  start = benchClock::now();
+  neurons.scanNeuronsForSignals();
+  double scanMsecs = msecsSince(start);
+  std::int64_t scanAllocs = heapAllocations - before;
+
+  // Oct 2026: enqueue/purge churn - bursts of signals onto every neuron then purge them all.
+  // Old pattern is a vector per neuron released with the swap trick; new one is the pool arena.
+  constexpr int32_t churnRounds{5};
+  std::vector<std::vector<int32_t>> vectorQueues(poolSize);
+  before = heapAllocations;
+  start = benchClock::now();
+  for (int32_t round = 0; round < churnRounds; ++round)
+  {
+    for (int32_t n = 0; n < poolSize; ++n)
+    {
+      for (int32_t s = 0; s < signalsPerNeuron; ++s) { vectorQueues[n].push_back(s); }
+    }
+    for (int32_t n = 0; n < poolSize; ++n)
+    {
+      std::vector<int32_t>().swap(vectorQueues[n]);
+    }
+  }
+  double vectorChurnMsecs = msecsSince(start);
+  std::int64_t vectorChurnAllocs = heapAllocations - before;
+
+  before = heapAllocations;
+  start = benchClock::now();
+  for (int32_t round = 0; round < churnRounds; ++round)
+  {
+    for (int32_t n = 0; n < poolSize; ++n)
+    {
+      for (int32_t s = 0; s < signalsPerNeuron; ++s) { m_neuronPool.incomingSignals[n].push_back(s); }
+    }
+    for (int32_t n = 0; n < poolSize; ++n)
+    {
+      m_neuronPool.incomingSignals[n].release();
+    }
+  }
+  double arenaChurnMsecs = msecsSince(start);
+  std::int64_t arenaChurnAllocs = heapAllocations - before;
+
+  std::cout << "Neurons visited:= " << poolSize << " (" << visited << " queue entries seen)\n";
+  std::cout << "By value visit:      " << byValueAllocs << " heap allocations  " << byValueMsecs << " msecs\n";
+  std::cout << "By reference visit:  " << byRefAllocs << " heap allocations  " << byRefMsecs << " msecs\n";
+  std::cout << "Scan + purge, all due: " << scanAllocs << " heap allocations  " << scanMsecs << " msecs\n";
+  std::cout << "Churn, vector queues:  " << vectorChurnAllocs << " heap allocations  " << vectorChurnMsecs << " msecs\n";
+  std::cout << "Churn, signal arena:  " << arenaChurnAllocs << " heap allocations  " << arenaChurnMsecs << " msecs\n";
+  m_neuronPool.incomingSignals.printStats();
+  return 0;
+}
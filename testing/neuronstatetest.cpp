@@ -0,0 +1,208 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern int32_t globalNextEvent;
+
+extern std::vector<connection::Connection> m_connPool;
+extern std::vector<signal::Signal> m_srb;
+extern int32_t currentSignalSlot;
+extern int32_t signalBufferCapacity;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Regression test: refractory and purge updates made by the neuron scan must stick
+ * in m_neuronPool.
+ * 
+ * @details The scan and purgeOldSignals used to work on copies of the neuron, so refractoryEnd,
+ * nextEvent and the purged queue were all lost when the copy went out of scope.
+ * 
+ * n[1] gets a cascading signal at masterClock plus a pile of old signals, one signal inside
+ * its coming refractory period and one beyond it. It's single connection points at n[2].
+ * n[3] is refractory at masterClock and only holds stale signals.
+ * 
+ * Success:
+ *  n[1] refractoryEnd = masterClock + refractoryWidth
+ *  n[1] queue only holds the post-refractory signal and nextEvent is that signal's time
+ *  n[2] received the cascade signal and has the matching nextEvent
+ *  n[3] queue is empty and has given back its heap
+ * 
+ * Oct 2026: the purges are made by the purge sweep at the end of the tick, and the tick's
+ * activity and active set must name the neurons involved. Then every neuron is given stale
+ * signals and the sweep must reclaim no more than its budget a tick, carry on from its cursor
+ * and, lap by lap, empty every queue and with it the active set. Finally handles made stale in the
+ * middle of a queue must not throw the searches, the sorted insert or the aggregation window off.
+ * 
+ * @return  0 if ok; else the number of failed checks
+ */
+
+int32_t newSignal(int32_t actionTime, int16_t amplitude)
+{
+  // pseudo-allocation from the srb
+  int32_t slot = (currentSignalSlot >= signalBufferCapacity - 1) ? (currentSignalSlot = 0) : ++currentSignalSlot;
+  m_srb[slot] = srb::makeSignal(actionTime, 0, amplitude);
+  return slot;
+}
+
+int32_t putSignal(int32_t neuronIdx, int32_t actionTime, int16_t amplitude)
+{
+  // then enqueue on the neuron
+  int32_t slot = newSignal(actionTime, amplitude);
+  m_neuronPool.incomingSignals[neuronIdx].push_back(srb::makeHandle(slot));
+  return slot;
+}
+
+void putStale(int32_t neuronIdx)
+{
+  // a handle a lap out of date, as if its slot had been reused since it was queued
+  srb::SignalHandle handle = srb::makeHandle(newSignal(masterClock, 100));
+  m_neuronPool.incomingSignals[neuronIdx].push_back(handle ^ (1 << srb::handleSlotBits));
+}
+
+int main ()
+{
+  srb::SignalRingBuffer srb = srb::SignalRingBuffer(1000);
+  conns::Connections connections = conns::Connections(100);
+  neurons::Neurons neurons = neurons::Neurons(100);
+
+  masterClock = 100;
+  eventWheel.reset(masterClock);
+
+  // n[1] -> n[2] with a temporal distance of 10
+  m_connPool[1] = connection::Connection{2, 0, 10, 1000, 0};
+  m_neuronPool.addOutgoing(1, 1);
+  m_neuronPool.buildOutgoingIndex();
+
+  for (int32_t n : {1, 2, 3})
+  {
+    m_neuronPool.refractoryEnd[n] = masterClock - 50;
+    m_neuronPool.nextEvent[n] = INT32_MAX;
+  }
+
+  for (int32_t t = 0; t < 15; ++t)
+  {
+    putSignal(1, t, 100);                                       // long past the aggregation window
+  }
+  putSignal(1, masterClock, tconst::cascadeThreshold + 1);      // cascades n[1] now
+  putSignal(1, masterClock + 3, 1000);                          // arrives while refractory
+  int32_t futureSlot = putSignal(1, masterClock + 200, 1000);   // after refractory
+  m_neuronPool.nextEvent[1] = masterClock;
+  eventWheel.schedule(1, masterClock);
+
+  // n[3] is refractory and only holds stale signals
+  m_neuronPool.refractoryEnd[3] = masterClock + 2;
+  putSignal(3, masterClock - 40, 1000);
+  putSignal(3, masterClock - 30, 1000);
+  putSignal(3, masterClock, 1000);
+  m_neuronPool.nextEvent[3] = masterClock;
+  eventWheel.schedule(3, masterClock);
+
+  neurons.scanNeuronsForSignals();
+  std::cout << '\n';
+
+  check(m_neuronPool.refractoryEnd[1] == masterClock + tconst::refractoryWidth, "n[1] refractoryEnd persisted");
+  check(m_neuronPool.incomingSignals[1].size() == 1 &&
+        srb::handleSlot(m_neuronPool.incomingSignals[1][0]) == futureSlot, "n[1] purge persisted - only the post-refractory signal is left");
+  check(m_neuronPool.nextEvent[1] == masterClock + 200, "n[1] nextEvent is the post-refractory signal");
+  check(m_neuronPool.incomingSignals[2].size() == 1 &&
+        srb::handleActionTime(m_neuronPool.incomingSignals[2].back()) == masterClock + 10, "n[2] received the cascade signal");
+  check(m_neuronPool.nextEvent[2] == masterClock + 10, "n[2] nextEvent follows the cascade signal");
+  check(m_neuronPool.incomingSignals[3].empty() &&
+        m_neuronPool.incomingSignals[3].capacity() == 0, "n[3] purge sweep emptied and released its queue");
+  check(m_neuronPool.nextEvent[3] == INT32_MAX, "n[3] has nothing left to do");
+  check(globalNextEvent == masterClock + 10, "globalNextEvent is the earliest pending signal");
+
+  // the tick's activity and the active set
+  const active::ActivityStats& activity = neurons.activity();
+  const active::ActiveSet& members = m_neuronPool.activeNeurons;
+  check(activity.due == 2 && activity.cascades == 1 && activity.joined == 3 && activity.members == 3,
+        "activity: n[1] and n[3] due, n[1] cascaded, three neurons joined");
+  check(members.contains(1) && members.contains(2) && members.contains(3) && !members.contains(4),
+        "active set: n[1] and n[2] hold signals, n[3] is still refractory, idle n[4] is not a member");
+
+  // the purge sweep keeps to its budget and drops idle members
+  masterClock += 1000;
+  for (int32_t n = 0; n < 100; ++n)
+  {
+    for (int32_t s = 0; s < 4; ++s)
+    {
+      putSignal(n, masterClock - 500 + s, 100);
+    }
+    m_neuronPool.activeNeurons.insert(n);     // signals put by hand join by hand
+  }
+  int64_t queued{0};
+  for (int32_t n = 0; n < 100; ++n)
+  {
+    queued += static_cast<int64_t>(m_neuronPool.incomingSignals[n].size());
+  }
+  int64_t total = neurons.sweepStaleSignals(30, 50);
+  int32_t left = 100 - members.size();
+  check(total == 50 && left > 0 && left < 30, "sweep stops at its entry budget");
+  total += neurons.sweepStaleSignals(30, 1000);
+  check(100 - members.size() == left + 30, "sweep stops at its neuron limit");
+  for (int32_t lap = 0; lap < 4; ++lap)
+  {
+    total += neurons.sweepStaleSignals(30, 1000);
+  }
+  bool emptied{true};
+  for (int32_t n = 0; n < 100; ++n)
+  {
+    emptied = emptied && m_neuronPool.incomingSignals[n].empty();
+  }
+  check(emptied && total == queued && members.empty(), "sweep empties every stale queue and the active set");
+
+  // handles that went stale in the middle of a queue: the searches step over them
+  const int32_t longQueue{50};
+  int32_t wanted{-1};
+  for (int32_t t = 1; t <= 40; ++t)
+  {
+    int32_t slot = putSignal(longQueue, masterClock + t, 100);
+    wanted = (t == 20) ? slot : wanted;
+    for (int32_t stale = (t == 20) ? 30 : (t % 3 == 0) ? 1 : 0; stale > 0; --stale)
+    {
+      putStale(longQueue);
+    }
+  }
+  arena::SignalQueue queue = m_neuronPool.incomingSignals[longQueue];
+  const int32_t* found = neurons::Neurons::firstSignalAtOrAfter(queue, masterClock + 20);
+  check(queue.size() > neurons::Neurons::linearSearchLimit && found != queue.end() &&
+        srb::handleSlot(*found) == wanted, "binary search finds the first current signal past stale handles");
+  connections.enqueueSignal(longQueue, srb::makeHandle(newSignal(masterClock + 15, 100)), masterClock + 15);
+  int32_t previous{INT32_MIN};
+  bool ordered{true};
+  for (srb::SignalHandle handle : m_neuronPool.incomingSignals[longQueue])
+  {
+    if (srb::isCurrent(handle))
+    {
+      ordered = ordered && srb::handleActionTime(handle) >= previous;
+      previous = srb::handleActionTime(handle);
+    }
+  }
+  check(ordered, "insert_sorted keeps the current handles in order past stale ones");
+
+  const int32_t window{60};
+  for (int32_t t = -tconst::aggregation_window_ticks + 1; t <= 1; ++t)
+  {
+    putSignal(window, masterClock + t, 100);
+    putStale(window);
+  }
+  queue = m_neuronPool.incomingSignals[window];
+  const int32_t* windowEnd = neurons::Neurons::firstSignalAtOrAfter(queue, masterClock + 1);
+  const int32_t* windowBegin = neurons::Neurons::aggregationWindowStart(queue, windowEnd, INT32_MIN);
+  check(srb::handleActionTime(*windowBegin) == masterClock - tconst::aggregation_window_ticks + 1 &&
+        srb::handleActionTime(*windowEnd) == masterClock + 1, "the aggregation window reaches past stale handles");
+
+  std::cout << "\nneuronstatetest failures:= " << failures << std::endl;
+  return failures;
+}
@@ -23,7 +23,7 @@ extern std::vector<signal::Signal> m_srb;
 extern int32_t currentSignalSlot;
 extern int32_t signalBufferCapacity;
 
-extern std::vector<neuron::Neuron> m_neuronPool;
+extern neuron::NeuronPool m_neuronPool;
 extern int32_t currentNeuronSlot;
 extern int32_t neuronPoolCapacity;
 
@@ -62,11 +62,6 @@ int main ()
   conns::Connections connections = conns::Connections(1000000);
   neurons::Neurons neurons = neurons::Neurons(15000);
 
-  // These objects are used for accessing printer routines
-  conns::Connections* connObj = &connections;
-  neurons::Neurons* neuronObj = &neurons;
-  srb::SignalRingBuffer* srbObj = &srb;
-
   // Indexes into pools used as vector ptrs are too volatile
   int32_t connIdx;
   int32_t neuronIdx;
@@ -134,11 +129,10 @@ int main ()
   // neuronPtr = &m_neuronPool[neuronSlot];
 
 
-  std::cout << "\nFirst neuron first signal slot\n";
-  srb.printSignalFromIndex(m_neuronPool[0].incomingSignals[0]);
-
-  std::cout << "\nFirst neuron first connection slot\n";
-  connections.printConnectionFromIndex(m_neuronPool[0].outgoingSignals[0]);
+  // Oct 2026: neurons no longer start with fake first slots - both queues are empty
+  std::cout << "\nFirst neuron incoming/outgoing sizes:= " <<
+            std::to_string(m_neuronPool.incomingSignals[0].size()) << " / " <<
+            std::to_string(m_neuronPool.outgoing(0).size());
   std::cout << "\n";
   
 
@@ -196,7 +190,7 @@ int main ()
   // Make sure neuron is out of refractory period so signals will enqueue
   // Master clock is set @ 1000
 
-  m_neuronPool[neuronIdx].refractoryEnd = 200;
+  m_neuronPool.refractoryEnd[neuronIdx] = 200;
 
 
   // neuronRef.outgoingSignals.push_back(&connRef);  // push a pointer onto the neuron outgoing signal vector
@@ -205,7 +199,8 @@ int main ()
   std::cout << "\n>>> ConnRef before we push it into neuron[0]:= \n";
   connections.printConnectionFromIndex(connIdx);
 
-  m_neuronPool[neuronIdx].outgoingSignals[0] = connIdx;          
+  m_neuronPool.addOutgoing(neuronIdx, connIdx);
+  m_neuronPool.buildOutgoingIndex();
   // This should leave the outgoing signal length @ 1
 
   std::cout << "\nAfter modifying outgoingSignals in neuron[0]\n";
@@ -213,16 +208,16 @@ int main ()
 
   
   std::cout << "\nPrint outgoingSignal slot tempDist:= " << 
-            std::to_string(m_connPool[m_neuronPool[neuronIdx].outgoingSignals[0]].temporalDistanceToTarget) << std::endl;
+            std::to_string(m_connPool[*m_neuronPool.outgoing(neuronIdx).begin()].temporalDistanceToTarget) << std::endl;
 
   std::cout << "\nNewly enqueued conn to Neuron from connRef\n";
 
-  // connections.printConnectionFromIndex(m_neuronPool[neuronIdx].outgoingSignals[0]);
+  // connections.printConnectionFromIndex(*m_neuronPool.outgoing(neuronIdx).begin());
   // std::cout <<std::endl;
 
   std::cout << "Retrieve and print from neuron outgoingSignals vector using neuronIdx:= " <<
             std::to_string(neuronIdx) << '\n';
-  connections.printConnectionFromIndex(m_neuronPool[neuronIdx].outgoingSignals[0]);
+  connections.printConnectionFromIndex(*m_neuronPool.outgoing(neuronIdx).begin());
   //
   // For whatever reason the refence below does not work...have to use neuronRef to
   // get the correct answer.
@@ -247,17 +242,15 @@ int main ()
 
   // For testing fix up the neuron's next event to be current masterClock
 
-  m_neuronPool[neuronIdx].nextEvent = masterClock;  // This is the clock tick we are processing
+  m_neuronPool.nextEvent[neuronIdx] = masterClock;  // This is the clock tick we are processing
 
 
   // provision enqueue a signal that will cause neuron 0 to cascade
 
-  int32_t futureSignalTime{1000};   // testing value beyond end of refractory period
-
-  if (masterClock > m_neuronPool[neuronIdx].refractoryEnd)
+  if (masterClock > m_neuronPool.refractoryEnd[neuronIdx])
   { 
     std:: cout << "\nmasterClock vs. refractoryEnd: = " << std::to_string(masterClock) <<
-        " vs. " << std::to_string(m_neuronPool[neuronIdx].refractoryEnd) << '\n';
+        " vs. " << std::to_string(m_neuronPool.refractoryEnd[neuronIdx]) << '\n';
 
     // if it's worth enqueing the signal
 
@@ -280,11 +273,9 @@ int main ()
     srb.printSignalFromIndex(nextSignalSlot);   // should be a proto signal from srb constructor time
     std::cout << std::endl;
 
-    m_srb[nextSignalSlot].actionTime = 1100;     // beyond neuron refractory end
-    m_srb[nextSignalSlot].amplitude = tconst::cascadeThreshold + 1; // make signal large enough to cascade
-    // ownership is used to ensure incomingSignal queues do not process the wrong signal if
-    // the srb has wrapped and reused an old signal
-    m_srb[nextSignalSlot].owner = neuronSlot; // remember neuron that owns the signal
+    // beyond neuron refractory end, and large enough to cascade
+    // Oct 2026: no owner to set - the generation tagged handle guards against srb wrap
+    m_srb[nextSignalSlot] = srb::makeSignal(1100, 0, tconst::cascadeThreshold + 1);
 
     std::cout << "Modified first signal slot: " << '\n';
     srb.printSignalFromIndex(nextSignalSlot);
@@ -294,40 +285,44 @@ int main ()
     // In future testing we will scan the outgoing signal queue and push signal onto the neuron
     // designated by the outgoing connection target
 
-    m_neuronPool[neuronIdx].incomingSignals.push_back(nextSignalSlot);
+    m_neuronPool.incomingSignals[neuronIdx].push_back(srb::makeHandle(nextSignalSlot));
 
     // Have to add this scan of incomingSignals every time we enque a new signal.
 
     std::cout << "\nmasterClock:= " << std::to_string(masterClock) << '\n';
 
-    m_neuronPool[neuronIdx].nextEvent = INT32_MAX;  // Ensure we capture the next lowest event from signals
+    m_neuronPool.nextEvent[neuronIdx] = INT32_MAX;  // Ensure we capture the next lowest event from signals
     globalNextEvent = INT32_MAX;                    // Ensure we capture the next lowest neuron event.
   
-    for (int32_t signalScanIdx : m_neuronPool[neuronIdx].incomingSignals) // This is the c++ forEach
-    // for (int32_t signalScanIdx=0; signalScanIdx < m_neuronPool[neuronIdx].incomingSignals.size(); ++signalScanIdx)
+    for (srb::SignalHandle signalHandle : m_neuronPool.incomingSignals[neuronIdx]) // This is the c++ forEach
+    // for (int32_t signalScanIdx=0; signalScanIdx < m_neuronPool.incomingSignals[neuronIdx].size(); ++signalScanIdx)
     {
+      int32_t signalScanIdx = srb::handleSlot(signalHandle);   // queues hold generation tagged handles
       // Note: forEach delivers the index into the srb pool, not the incoming signals vector
       std::cout << "\nsignalScanIdx:= " << std::to_string(signalScanIdx);
-      std::cout << "\nincomingSignal size:= " << std::to_string(m_neuronPool[neuronIdx].incomingSignals.size());
+      std::cout << "\nincomingSignal size:= " << std::to_string(m_neuronPool.incomingSignals[neuronIdx].size());
       std::cout << "\nincomingSignal clock:= " << 
-        std::to_string(m_srb[signalScanIdx].actionTime);
+        std::to_string(srb::actionTime(m_srb[signalScanIdx]));
 
-      if (m_srb[signalScanIdx].actionTime > masterClock)
+      if (srb::actionTime(m_srb[signalScanIdx]) > masterClock)
       {
         // This test should drop any proto signals with INT32_MIN actionTimes
         // Only interested in future events
         // Oldest signal/smallest clock is the next event of interest
         // nextEvent alway primed with INT32_MAX so at least one signal will qualify
-        m_neuronPool[neuronIdx].nextEvent = 
-          (m_srb[signalScanIdx].actionTime < m_neuronPool[neuronIdx].nextEvent) ? 
-                m_srb[signalScanIdx].actionTime : m_neuronPool[neuronIdx].nextEvent;
+        m_neuronPool.nextEvent[neuronIdx] = 
+          (srb::actionTime(m_srb[signalScanIdx]) < m_neuronPool.nextEvent[neuronIdx]) ? 
+                srb::actionTime(m_srb[signalScanIdx]) : m_neuronPool.nextEvent[neuronIdx];
       }
     }
     // make globalNextEvent the oldest of the neuronEvents.
-    globalNextEvent = (globalNextEvent <= m_neuronPool[neuronIdx].nextEvent) ? 
-                          globalNextEvent : m_neuronPool[neuronIdx].nextEvent;
+    globalNextEvent = (globalNextEvent <= m_neuronPool.nextEvent[neuronIdx]) ? 
+                          globalNextEvent : m_neuronPool.nextEvent[neuronIdx];
 
-    std::cout << "\n\nNeuron next event:= " << std::to_string(m_neuronPool[neuronIdx].nextEvent);
+    // the scan only visits neurons the event wheel has due, so schedule the neuron at its next event
+    eventWheel.schedule(neuronIdx, m_neuronPool.nextEvent[neuronIdx]);
+
+    std::cout << "\n\nNeuron next event:= " << std::to_string(m_neuronPool.nextEvent[neuronIdx]);
     std::cout << "\n\nGlobal next event:= " << std::to_string(globalNextEvent);
     // node vector queues are always indexes, never the underlying structure
 
@@ -347,16 +342,20 @@ int main ()
 
     int32_t tempNeuronIdx = 0;
     std::cout << "\nNeuron [0]\n";
-    std::cout << "Refractory end: " << std::to_string(m_neuronPool[tempNeuronIdx].refractoryEnd) << std::endl;
+    std::cout << "Refractory end: " << std::to_string(m_neuronPool.refractoryEnd[tempNeuronIdx]) << std::endl;
     neurons.printNeuronFromIndex(tempNeuronIdx);
 
     tempNeuronIdx = 1;
     std::cout << "\nExpect to see an empty unused neuron\n";
     std::cout << "Neuron [1]\n";
-    std::cout << "Refractory end: " << std::to_string(m_neuronPool[tempNeuronIdx].refractoryEnd) << std::endl;
+    std::cout << "Refractory end: " << std::to_string(m_neuronPool.refractoryEnd[tempNeuronIdx]) << std::endl;
     neurons.printNeuronFromIndex(tempNeuronIdx);
     std::cout << '\n';
 
+    // jump the masterClock to the signal we just enqueued
+    neurons.advanceMasterClock();
+    std::cout << "\nmasterClock advanced to:= " << std::to_string(masterClock) << '\n';
+
     neurons.scanNeuronsForSignals();
   }
 
@@ -365,9 +364,9 @@ int main ()
 
   std::cout << "\nNeuron index: = " << std::to_string(neuronIdx);
 
-  for (int32_t sigRef : m_neuronPool[neuronIdx].incomingSignals)
+  for (srb::SignalHandle sigRef : m_neuronPool.incomingSignals[neuronIdx])
   {
-    srb.printSignalFromIndex(sigRef);
+    srb.printSignalFromIndex(srb::handleSlot(sigRef));
     std::cout << '\n';
   }
   std::cout << "End of oneconnection test..." << std::endl;
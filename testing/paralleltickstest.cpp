@@ -0,0 +1,184 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+
+extern int32_t masterClock;
+extern int32_t currentSignalSlot;
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief The parallel tick engine must reproduce the serial engine exactly.
+ *
+ * @details A random network of twelve SixPacks - every neuron fans out to neurons anywhere in
+ * the pool, so most signals cross partitions - is seeded with a burst of signals and run for a
+ * fixed number of ticks. After every tick the whole state is folded into a digest: masterClock,
+ * every neuron's nextEvent, refractoryEnd and queue of handles, the srb cursor and contents and
+ * every connection's last signal time. The small srb wraps, so stale handles are exercised too.
+ * The active set's members, in set order, are folded in as well, and the cascades are counted
+ * from the tick's activity statistics.
+ *
+ * The serial engine (one thread, one partition) is the reference. Several thread and partition
+ * counts, including more partitions than threads and partition counts that do not divide the
+ * pool evenly, must give the same digest on every tick.
+ *
+ * @return  0 if ok; else the number of engines that diverged
+ */
+
+constexpr int32_t sixPacks{12};
+constexpr int32_t poolSize{sixPacks * tconst::sixpack_size};
+constexpr int32_t fanOut{12};
+constexpr int32_t ringSize{20000};
+constexpr int32_t ticks{300};
+
+struct Engine {
+  int32_t threads;
+  int32_t partitions;
+};
+
+uint64_t fold(uint64_t digest, int64_t value)
+{
+  // FNV-1a over the value's bytes
+  for (int i = 0; i < 8; ++i)
+  {
+    digest ^= static_cast<uint64_t>(value >> (8 * i)) & 0xFF;
+    digest *= 1099511628211ULL;
+  }
+  return digest;
+}
+
+uint64_t stateDigest()
+{
+  uint64_t digest{14695981039346656037ULL};
+  digest = fold(digest, masterClock);
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    digest = fold(digest, m_neuronPool.nextEvent[n]);
+    digest = fold(digest, m_neuronPool.refractoryEnd[n]);
+    digest = fold(digest, static_cast<int64_t>(m_neuronPool.incomingSignals[n].size()));
+    for (srb::SignalHandle handle : m_neuronPool.incomingSignals[n])
+    {
+      digest = fold(digest, handle);
+    }
+  }
+  digest = fold(digest, currentSignalSlot);
+  for (const signal::Signal& s : m_srb)
+  {
+    digest = fold(digest, srb::actionTime(s));
+    digest = fold(digest, s.sourceConnId);
+    digest = fold(digest, s.amplitude);
+  }
+  for (const connection::Connection& c : m_connPool)
+  {
+    digest = fold(digest, c.lastSignalOriginTime);
+  }
+  for (int32_t neuronId : m_neuronPool.activeNeurons)
+  {
+    digest = fold(digest, neuronId);
+  }
+  return digest;
+}
+
+std::vector<uint64_t> runEngine(neurons::Neurons& neurons, conns::Connections& connections,
+                                const Engine& engine, int64_t& cascades, int64_t& activeTicks)
+{
+  // same network and seed signals every time
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+  m_neuronPool.resize(poolSize, INT32_MAX, -tconst::refractoryWidth - 1);   // every neuron ready to cascade
+  neurons.setTickThreads(engine.threads, engine.partitions);
+  masterClock = 0;
+  eventWheel.reset(masterClock);
+
+  std::mt19937 rng(20261017);
+  int32_t conn{1};
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    for (int32_t f = 0; f < fanOut; ++f, ++conn)
+    {
+      int32_t target = static_cast<int32_t>(rng() % poolSize);
+      int32_t distance = 1 + static_cast<int32_t>(rng() % 12);
+      int16_t weight = static_cast<int16_t>(4000 + rng() % 9000);
+      m_connPool[conn] = connection::Connection{target, 0, distance, weight, 0};
+      m_neuronPool.addOutgoing(n, conn);
+    }
+  }
+  m_neuronPool.buildOutgoingIndex();
+
+  for (int32_t i = 0; i < poolSize / 8; ++i)
+  {
+    int32_t target = static_cast<int32_t>(rng() % poolSize);
+    int32_t slot = ring.allocateSignalSlot();
+    m_srb[slot] = srb::makeSignal(1 + static_cast<int32_t>(rng() % 20), 0, tconst::cascadeThreshold);
+    if (connections.enqueueSignal(target, srb::makeHandle(slot), srb::actionTime(m_srb[slot])))
+    {
+      eventWheel.schedule(target, srb::actionTime(m_srb[slot]));
+    }
+  }
+
+  std::vector<uint64_t> digests;
+  cascades = 0;
+  activeTicks = 0;
+  for (int32_t t = 0; t < ticks && neurons.advanceMasterClock() != INT32_MAX; ++t)
+  {
+    neurons.scanNeuronsForSignals();
+    cascades += neurons.activity().cascades;
+    activeTicks += neurons.activity().members;
+    digests.push_back(stateDigest());
+  }
+  return digests;
+}
+
+int main ()
+{
+  conns::Connections connections = conns::Connections(poolSize * fanOut + 1);
+  neurons::Neurons neurons = neurons::Neurons(poolSize);
+
+  const Engine engines[] = { {1, 1}, {4, 4}, {2, 12}, {3, 5}, {1, 7}, {8, 0} };
+  std::vector<uint64_t> reference;
+  int32_t failures{0};
+
+  for (const Engine& engine : engines)
+  {
+    int64_t cascades{0};
+    int64_t activeTicks{0};
+    std::vector<uint64_t> digests = runEngine(neurons, connections, engine, cascades, activeTicks);
+    if (reference.empty())
+    {
+      reference = digests;
+    }
+
+    std::size_t firstDifference{0};
+    while (firstDifference < digests.size() && firstDifference < reference.size() &&
+           digests[firstDifference] == reference[firstDifference])
+    {
+      ++firstDifference;
+    }
+    bool same = digests.size() == reference.size() && firstDifference == digests.size();
+
+    std::cout << (same ? "PASS: " : "FAIL: ") << engine.threads << " threads, " << tickPartitions.count()
+              << " partitions: " << digests.size() << " ticks, " << cascades << " cascades, "
+              << srbStats.wraps << " srb wraps, " << activeTicks / (digests.empty() ? 1 : digests.size())
+              << " of " << poolSize << " neurons active per tick";
+    if (!same)
+    {
+      std::cout << " - first differs at tick " << firstDifference;
+    }
+    std::cout << '\n';
+    failures += same ? 0 : 1;
+  }
+
+  neurons.setTickThreads(1);
+  std::cout << "\nparalleltickstest failures:= " << failures << std::endl;
+  return failures;
+}
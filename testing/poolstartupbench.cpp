@@ -0,0 +1,127 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <new>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Time pool construction at 1M, 10M and 100M elements.
+ *
+ * @details For each size the old way of building a pool - reserve, then push_back a prototype
+ * up to capacity(), with a vector of Neuron structs holding two std::vector queues each for the
+ * neurons - is timed against today's constructors: Connections, SignalRingBuffer and Neurons.
+ * The bulk time is also given per element, so the sizes compare directly.
+ * Each pool is checked to hold size blank elements. The old neuron pool is 64 bytes a neuron
+ * before it has a single signal, so it is skipped above oldNeuronLimit.
+ *
+ * usage: poolstartupbench [largest size]      e.g. poolstartupbench 10000000 on a small machine
+ * Build with -DNDEBUG so tracing does not swamp the timings; add -DTCN_HUGE_PAGES=1 to compare
+ * huge page backed pools.
+ *
+ * @return  0 if ok; else the number of pools built with the wrong contents
+ */
+
+using benchClock = std::chrono::steady_clock;
+
+constexpr std::int64_t oldNeuronLimit{std::int64_t{2} << 30};    // bytes
+
+double msecsSince(benchClock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+}
+
+struct OldNeuron {
+  std::vector<std::int32_t> incomingSignals;
+  std::vector<std::int32_t> outgoingSignals;
+  std::int32_t nextEvent;
+  std::int32_t refractoryEnd;
+};
+
+template <typename T>
+double pushBackPool(std::int64_t size, const T& proto)
+{
+  // the constructors as they were
+  auto start = benchClock::now();
+  std::vector<T> pool;
+  pool.reserve(static_cast<std::size_t>(size));
+  for (std::size_t i = 0; i < pool.capacity(); ++i)
+  {
+    pool.push_back(proto);
+  }
+  return msecsSince(start);
+}
+
+void report(const char* pool, std::int64_t size, double before, double now)
+{
+  std::cout << "  " << pool << ": push_back ";
+  if (before < 0.0)
+  {
+    std::cout << "skipped";
+  }
+  else
+  {
+    std::cout << before << " msecs";
+  }
+  std::cout << ", bulk " << now << " msecs";
+  if (before > 0.0)
+  {
+    std::cout << " (" << before / now << "x)";
+  }
+  std::cout << ", " << now * 1e6 / static_cast<double>(size) << " ns an element\n";
+}
+
+int main (int argc, char* argv[])
+{
+  std::int64_t largest = (argc > 1) ? std::atoll(argv[1]) : 100000000;
+  int32_t failures{0};
+  std::cout << "huge pages " << (pools::hugePages ? "on" : "off") << '\n';
+
+  for (std::int64_t size : {std::int64_t{1000000}, std::int64_t{10000000}, std::int64_t{100000000}})
+  {
+    if (size > largest)
+    {
+      break;
+    }
+    std::cout << size << " elements\n";
+
+    double before = pushBackPool(size, connection::Connection{-1, -1, -1, -1, -1});
+    auto start = benchClock::now();
+    conns::Connections connections = conns::Connections(static_cast<std::int32_t>(size));
+    report("connections", size, before, msecsSince(start));
+    failures += (static_cast<std::int64_t>(m_connPool.size()) == size && m_connPool.back().targetNeuronSlot == -1) ? 0 : 1;
+    std::vector<connection::Connection>().swap(m_connPool);
+
+    before = pushBackPool(size, signal::Signal{INT32_MIN, srb::longPast, 1000});
+    start = benchClock::now();
+    srb::SignalRingBuffer ring = srb::SignalRingBuffer(static_cast<std::int32_t>(size));
+    report("srb", size, before, msecsSince(start));
+    failures += (static_cast<std::int64_t>(m_srb.size()) == size && srb::actionTime(m_srb.back()) == INT32_MIN) ? 0 : 1;
+    std::vector<signal::Signal>().swap(m_srb);
+
+    bool oldFits = size * static_cast<std::int64_t>(sizeof(OldNeuron)) <= oldNeuronLimit;
+    before = oldFits ? pushBackPool(size, OldNeuron{{}, {}, INT32_MAX, INT32_MAX}) : -1.0;
+    start = benchClock::now();
+    neurons::Neurons neurons = neurons::Neurons(static_cast<std::int32_t>(size));
+    report("neurons", size, before, msecsSince(start));
+    failures += (m_neuronPool.size() == size && m_neuronPool.nextEvent.back() == INT32_MAX &&
+                 m_neuronPool.incomingSignals[static_cast<std::int32_t>(size - 1)].empty()) ? 0 : 1;
+    m_neuronPool.resize(0, INT32_MAX, INT32_MAX);
+  }
+
+  std::cout << "\npoolstartupbench failures:= " << failures << std::endl;
+  return failures;
+}
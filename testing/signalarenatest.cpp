@@ -0,0 +1,195 @@
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <random>
+#include <algorithm>
+#include "SignalArena.h"
+
+/**
+ * @brief Check the signal arena against a plain vector per neuron.
+ *
+ * @details Random pushes, in-place compactions (what purgeOldSignals does) and releases
+ * across a small pool, so queues move through several size classes and blocks get
+ * recycled through the free lists. Every queue is compared to its reference vector after
+ * each step. The arena is deliberately undersized so the slab has to grow as well.
+ *
+ * Oct 2026: second pass covers the actionTime ordered queues - insert_sorted against a sorted
+ * reference and prefix purges with drop_front, the way the neuron scan now uses them.
+ *
+ * Oct 2026: third pass splits the arena into uneven shards, as the parallel tick does, checks
+ * that every queue survived the move and keeps inserting and purging across the shards.
+ *
+ * @return  0 if ok; else the number of mismatched steps
+ */
+
+int main ()
+{
+  constexpr int32_t poolSize{64};
+  constexpr int32_t steps{200000};
+
+  arena::SignalArena queues;
+  queues.resize(poolSize, 1);
+  std::vector<std::vector<int32_t>> reference(poolSize);
+
+  std::mt19937 rng(20261017);
+  int32_t failures{0};
+
+  for (int32_t step = 0; step < steps; ++step)
+  {
+    int32_t n = static_cast<int32_t>(rng() % poolSize);
+    uint32_t action = rng() % 100;
+    arena::SignalQueue q = queues[n];
+
+    if (action < 80)
+    {
+      int32_t value = static_cast<int32_t>(rng() % 1000000);
+      q.push_back(value);
+      reference[n].push_back(value);
+    }
+    else if (action < 95)
+    {
+      // in-place compaction keeping roughly half, the way the purge does it
+      int32_t cut = static_cast<int32_t>(rng() % 1000000);
+      std::size_t kept{0};
+      for (int32_t v : q)
+      {
+        if (v >= cut) { q[kept++] = v; }
+      }
+      q.resize(kept);
+      std::size_t refKept{0};
+      for (int32_t v : reference[n])
+      {
+        if (v >= cut) { reference[n][refKept++] = v; }
+      }
+      reference[n].resize(refKept);
+    }
+    else
+    {
+      q.release();
+      reference[n].clear();
+    }
+
+    bool same = q.size() == reference[n].size() && q.size() <= q.capacity();
+    for (std::size_t i = 0; same && i < q.size(); ++i)
+    {
+      same = q[i] == reference[n][i];
+    }
+    if (!same)
+    {
+      ++failures;
+      std::cout << "FAIL: step " << step << " neuron " << n << '\n';
+    }
+  }
+
+  // every live entry must be accounted for
+  int64_t live{0};
+  for (const auto& r : reference) { live += static_cast<int64_t>(r.size()); }
+  if (live != queues.stats().liveEntries)
+  {
+    ++failures;
+    std::cout << "FAIL: live entries " << queues.stats().liveEntries << " vs " << live << '\n';
+  }
+  if (queues.stats().slabGrowths == 0)
+  {
+    ++failures;
+    std::cout << "FAIL: undersized slab never grew\n";
+  }
+
+  // a released queue owns nothing
+  queues[0].release();
+  if (queues[0].capacity() != 0 || !queues[0].empty())
+  {
+    ++failures;
+    std::cout << "FAIL: released queue still owns a block\n";
+  }
+
+  // ordered queues: values are their own actionTime keys
+  auto keyOf = [](int32_t v) { return v; };
+  queues.resize(poolSize, 1);
+  for (auto& r : reference) { r.clear(); }
+  int32_t clock{0};
+  for (int32_t step = 0; step < steps; ++step)
+  {
+    int32_t n = static_cast<int32_t>(rng() % poolSize);
+    uint32_t action = rng() % 100;
+    arena::SignalQueue q = queues[n];
+
+    if (action < 75)
+    {
+      int32_t value = clock + static_cast<int32_t>(rng() % 50);   // mostly near the tail
+      q.insert_sorted(value, keyOf);
+      reference[n].insert(std::upper_bound(reference[n].begin(), reference[n].end(), value), value);
+    }
+    else if (action < 98)
+    {
+      ++clock;
+      const int32_t* firstKept = std::lower_bound(q.begin(), q.end(), clock - 5);
+      q.drop_front(static_cast<std::size_t>(firstKept - q.begin()));
+      reference[n].erase(reference[n].begin(),
+                         std::lower_bound(reference[n].begin(), reference[n].end(), clock - 5));
+    }
+    else
+    {
+      q.release();
+      reference[n].clear();
+    }
+
+    bool same = q.size() == reference[n].size() && std::is_sorted(q.begin(), q.end());
+    for (std::size_t i = 0; same && i < q.size(); ++i)
+    {
+      same = q[i] == reference[n][i];
+    }
+    if (!same)
+    {
+      ++failures;
+      std::cout << "FAIL: ordered step " << step << " neuron " << n << '\n';
+    }
+  }
+
+  // shards: queues move to their own slab and carry on as before
+  int64_t liveBefore = queues.stats().liveEntries;
+  queues.partition({0, 5, 40, 41});
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    arena::SignalQueue q = queues[n];
+    bool same = q.size() == reference[n].size() && std::equal(q.begin(), q.end(), reference[n].begin());
+    if (!same)
+    {
+      ++failures;
+      std::cout << "FAIL: neuron " << n << " changed when the arena was sharded\n";
+    }
+  }
+  if (queues.shards() != 4 || queues.stats().liveEntries != liveBefore)
+  {
+    ++failures;
+    std::cout << "FAIL: sharded arena lost count of its entries\n";
+  }
+  for (int32_t step = 0; step < steps / 4; ++step)
+  {
+    int32_t n = static_cast<int32_t>(rng() % poolSize);
+    arena::SignalQueue q = queues[n];
+    if (rng() % 100 < 75)
+    {
+      int32_t value = clock + static_cast<int32_t>(rng() % 50);
+      q.insert_sorted(value, keyOf);
+      reference[n].insert(std::upper_bound(reference[n].begin(), reference[n].end(), value), value);
+    }
+    else
+    {
+      ++clock;
+      const int32_t* firstKept = std::lower_bound(q.begin(), q.end(), clock - 5);
+      q.drop_front(static_cast<std::size_t>(firstKept - q.begin()));
+      reference[n].erase(reference[n].begin(),
+                         std::lower_bound(reference[n].begin(), reference[n].end(), clock - 5));
+    }
+    if (q.size() != reference[n].size() || !std::equal(q.begin(), q.end(), reference[n].begin()))
+    {
+      ++failures;
+      std::cout << "FAIL: sharded step " << step << " neuron " << n << '\n';
+    }
+  }
+
+  queues.printStats();
+  std::cout << "\nsignalarenatest failures:= " << failures << std::endl;
+  return failures;
+}
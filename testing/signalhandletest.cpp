@@ -0,0 +1,106 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern std::vector<signal::Signal> m_srb;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Generation tagged signal handles reject references to reused srb slots.
+ *
+ * @details The srb slot behind a queued handle is reused, after a wrap, for another signal
+ * addressed to the same neuron - the case the old owner check let through. The handle must
+ * read as stale, the scan must not aggregate it and the purge must drop it.
+ * Oct 2026: generations are 8 bits, so a handle left queued 256 laps reads as current again. A
+ * neuron outside the active set, which the purge sweep never visits, keeps a stale handle while
+ * the ring goes round 256 times; the tick's stale handle sweep must have cleared it long before.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+int main ()
+{
+  constexpr int32_t ringSize{20};
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+  conns::Connections connections = conns::Connections(10);
+  neurons::Neurons neurons = neurons::Neurons(10);
+
+  masterClock = 100;
+  eventWheel.reset(masterClock);
+
+  // a handle from the first lap equals its slot number
+  int32_t slot = ring.allocateSignalSlot();
+  srb::SignalHandle handle = srb::makeHandle(slot);
+  check(handle == slot && srb::isCurrent(handle), "first lap handle is the slot and is current");
+
+  m_srb[slot] = srb::makeSignal(masterClock, 0, tconst::cascadeThreshold + 1);
+  m_neuronPool.incomingSignals[1].push_back(handle);
+
+  // go round the ring until the same slot is handed out again
+  int32_t reused{-1};
+  while (reused != slot)
+  {
+    reused = ring.allocateSignalSlot();
+  }
+  check(srbStats.wraps == 1, "ring wrapped once");
+  check(!srb::isCurrent(handle), "old handle is stale once its slot is reused");
+  check(srb::isCurrent(srb::makeHandle(reused)) && srb::makeHandle(reused) != handle, "new handle for the slot is current");
+
+  // the reused slot now holds a different cascading signal for the same neuron
+  m_srb[reused] = srb::makeSignal(masterClock, 0, tconst::cascadeThreshold + 1);
+  check(srb::actionTime(m_srb[srb::handleSlot(handle)]) == masterClock,
+        "the slot alone would still accept the old reference");
+  check(srb::handleActionTime(handle) == INT32_MIN, "stale handle reads as long past");
+
+  // scan n[1]: the stale handle must not cascade it
+  int32_t refractoryBefore = masterClock - 50;
+  m_neuronPool.refractoryEnd[1] = refractoryBefore;
+  m_neuronPool.nextEvent[1] = masterClock;
+  eventWheel.schedule(1, masterClock);
+  neurons.scanNeuronsForSignals();
+  std::cout << '\n';
+
+  check(m_neuronPool.refractoryEnd[1] == refractoryBefore, "n[1] did not cascade on a stale signal");
+  check(m_neuronPool.nextEvent[1] == INT32_MAX, "n[1] has nothing left to do");
+
+  // refractory purge drops the stale handle from the front of the queue
+  m_neuronPool.refractoryEnd[1] = masterClock + 1;
+  neurons.purgeOldSignals(1);
+  check(m_neuronPool.incomingSignals[1].empty(), "purge dropped the stale handle");
+
+  // n[2] holds a handle, never joins the active set and is never due
+  slot = ring.allocateSignalSlot();
+  handle = srb::makeHandle(slot);
+  m_srb[slot] = srb::makeSignal(masterClock + 1, 0, tconst::base_signal_size);
+  m_neuronPool.incomingSignals[2].push_back(handle);
+  const int64_t madeIn = srbStats.wraps;
+  bool sweptBeforeAlias{false};
+  while (srbStats.wraps < madeIn + 256 || slot > currentSignalSlot)
+  {
+    for (int32_t i = 0; i < ringSize && (srbStats.wraps < madeIn + 256 || slot > currentSignalSlot); ++i)
+    {
+      ring.allocateSignalSlot();
+    }
+    neurons.scanNeuronsForSignals();
+    sweptBeforeAlias = sweptBeforeAlias || m_neuronPool.incomingSignals[2].empty();
+  }
+  std::cout << '\n';
+  check(!m_neuronPool.activeNeurons.contains(2), "n[2] was never in the active set");
+  check(srb::isCurrent(handle), "256 laps on, the slot's generation matches the old handle again");
+  check(sweptBeforeAlias && m_neuronPool.incomingSignals[2].empty(), "the stale handle sweep dropped it first");
+  check(srbStats.wraps - srbStats.handleSweepWraps < srb::handleSweepLaps, "the sweep keeps up with the ring");
+
+  std::cout << "\nsignalhandletest failures:= " << failures << std::endl;
+  return failures;
+}
@@ -0,0 +1,248 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "WorkerPool.h"
+#include "TickPartitions.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern int32_t currentSignalSlot;
+extern int32_t signalBufferCapacity;
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Stress the concurrent delivery path: no signal may be lost or duplicated.
+ *
+ * @details Three parts, all run on 8 threads:
+ *    inboxes   8 producers post random sized bursts to 5 lock-free inboxes at the same time;
+ *              every sequence number must be drained exactly once, by the right inbox, in order
+ *    slots     partitions fill reserved srb blocks in parallel; every slot between the old and
+ *              new cursor must be written exactly once, with the slot number and handle the
+ *              one at a time allocateSignalSlot would have given, across ring wraps
+ *    engine    a busy network on the parallel tick; every tick the signals emitted must equal
+ *              the signals enqueued, with no srb slot enqueued twice
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+int main ()
+{
+  constexpr int32_t threads{8};
+  constexpr int32_t rounds{300};
+  workers::WorkerPool pool(threads);
+  std::mt19937 rng(20261017);
+
+  // inboxes
+  {
+    constexpr int32_t producers{8};
+    constexpr int32_t inboxes{5};
+    std::vector<tick::ArrivalWriter> writers(producers);
+    std::vector<tick::ArrivalInbox> boxes(inboxes);
+    std::vector<std::vector<tick::Arrival>> drained(inboxes);
+    std::vector<int32_t> seen;
+    bool exact{true};
+    bool routed{true};
+    bool ordered{true};
+    int64_t posted{0};
+
+    for (int32_t round = 0; round < rounds && exact && routed && ordered; ++round)
+    {
+      // each producer gets a random burst; sequence numbers are handed out in producer order
+      std::vector<int32_t> burst(producers);
+      std::vector<int32_t> firstSequence(producers);
+      int32_t total{0};
+      for (int32_t p = 0; p < producers; ++p)
+      {
+        burst[p] = static_cast<int32_t>(rng() % 3000);
+        firstSequence[p] = total;
+        total += burst[p];
+      }
+      std::vector<uint32_t> seeds(producers);
+      for (uint32_t& seed : seeds) { seed = rng(); }
+
+      pool.run(producers, [&](int32_t p) {
+        std::mt19937 local(seeds[p]);
+        writers[p].reset(inboxes);
+        for (int32_t i = 0; i < burst[p]; ++i)
+        {
+          int32_t destination = static_cast<int32_t>(local() % inboxes);
+          writers[p].append(boxes[destination], destination,
+                            tick::Arrival{destination, 0, 0, firstSequence[p] + i});
+        }
+        writers[p].flush([&](int32_t d) -> tick::ArrivalInbox& { return boxes[d]; });
+      });
+      pool.run(inboxes, [&](int32_t d) {
+        drained[d].clear();
+        boxes[d].drain(drained[d]);
+      });
+
+      seen.assign(total, 0);
+      for (int32_t d = 0; d < inboxes; ++d)
+      {
+        for (std::size_t i = 0; i < drained[d].size(); ++i)
+        {
+          const tick::Arrival& arrival = drained[d][i];
+          routed = routed && arrival.target == d;
+          ordered = ordered && (i == 0 || drained[d][i - 1].sequence < arrival.sequence);
+          if (arrival.sequence >= 0 && arrival.sequence < total)
+          {
+            ++seen[arrival.sequence];
+          }
+        }
+      }
+      for (int32_t count : seen) { exact = exact && count == 1; }
+      posted += total;
+    }
+    std::cout << posted << " arrivals through " << inboxes << " inboxes\n";
+    check(exact, "every arrival drained exactly once");
+    check(routed, "every arrival drained by the inbox it was posted to");
+    check(ordered, "drained arrivals are in emission order");
+  }
+
+  // slots
+  {
+    constexpr int32_t ringSize{1000};
+    constexpr int32_t partitions{8};
+    srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+    masterClock = 0;
+    std::vector<srb::SlotBlock> blocks(partitions);
+    std::vector<std::vector<srb::SignalHandle>> handles(partitions);
+    bool exact{true};
+    bool sameAsSerial{true};
+    bool current{true};
+
+    for (int32_t round = 0; round < rounds; ++round)
+    {
+      masterClock += 100;      // everything from earlier rounds is long past
+      srb::followClock(masterClock);   // the partitions write epochTime directly
+      int32_t cursor = currentSignalSlot;
+      int64_t wraps = srbStats.wraps;
+      int32_t total{0};
+      for (int32_t p = 0; p < partitions; ++p)
+      {
+        int32_t count = static_cast<int32_t>(rng() % (ringSize / partitions));
+        blocks[p] = ring.reserveSlots(count);
+        handles[p].resize(count);
+        total += count;
+      }
+
+      pool.run(partitions, [&](int32_t p) {
+        for (srb::SignalHandle& handle : handles[p])
+        {
+          int32_t slot = blocks[p].take();
+          m_srb[slot].epochTime = srb::toEpochTime(masterClock + 1);
+          m_srb[slot].sourceConnId = p;
+          handle = blocks[p].handle(slot);
+        }
+      });
+      ring.commitSlots(0);
+
+      // serial reference: allocateSignalSlot would have handed out cursor+1, cursor+2, ... round the ring
+      std::vector<int32_t> written(ringSize, 0);
+      int64_t next = static_cast<int64_t>(cursor) + 1;
+      for (int32_t p = 0; p < partitions; ++p)
+      {
+        for (srb::SignalHandle handle : handles[p])
+        {
+          int32_t slot = static_cast<int32_t>(next % ringSize);
+          uint32_t generation = static_cast<uint32_t>(wraps + next / ringSize) & 0xFFu;
+          sameAsSerial = sameAsSerial && srb::handleSlot(handle) == slot &&
+                         (static_cast<uint32_t>(handle) >> srb::handleSlotBits) == generation;
+          current = current && srb::isCurrent(handle);
+          exact = exact && m_srb[slot].sourceConnId == p;
+          ++written[slot];
+          ++next;
+        }
+      }
+      for (int32_t count : written) { exact = exact && count <= 1; }
+      sameAsSerial = sameAsSerial && currentSignalSlot == static_cast<int32_t>((static_cast<int64_t>(cursor) + total) % ringSize);
+    }
+    std::cout << srbStats.allocations << " slots in " << srbStats.wraps << " laps of the ring\n";
+    check(exact, "every reserved slot written once, by the partition that reserved it");
+    check(sameAsSerial, "reserved slots and handles match one at a time allocation");
+    check(current, "handles from reserved blocks are current after the commit");
+  }
+
+  // engine
+  {
+    constexpr int32_t poolSize{16 * tconst::sixpack_size};
+    constexpr int32_t fanOut{12};
+    srb::SignalRingBuffer ring = srb::SignalRingBuffer(50000);
+    conns::Connections connections = conns::Connections(poolSize * fanOut + 1);
+    neurons::Neurons neurons = neurons::Neurons(poolSize);
+    m_neuronPool.resize(poolSize, INT32_MAX, -tconst::refractoryWidth - 1);
+    neurons.setTickThreads(threads, 2 * threads);
+    masterClock = 0;
+    eventWheel.reset(masterClock);
+
+    int32_t conn{1};
+    for (int32_t n = 0; n < poolSize; ++n)
+    {
+      for (int32_t f = 0; f < fanOut; ++f, ++conn)
+      {
+        int32_t target = static_cast<int32_t>(rng() % poolSize);
+        int32_t distance = 1 + static_cast<int32_t>(rng() % 12);
+        int16_t weight = static_cast<int16_t>(4000 + rng() % 9000);
+        m_connPool[conn] = connection::Connection{target, 0, distance, weight, 0};
+        m_neuronPool.addOutgoing(n, conn);
+      }
+    }
+    m_neuronPool.buildOutgoingIndex();
+    for (int32_t i = 0; i < poolSize / 8; ++i)
+    {
+      int32_t target = static_cast<int32_t>(rng() % poolSize);
+      int32_t slot = ring.allocateSignalSlot();
+      m_srb[slot] = srb::makeSignal(1 + static_cast<int32_t>(rng() % 20), 0, tconst::cascadeThreshold);
+      if (connections.enqueueSignal(target, srb::makeHandle(slot), srb::actionTime(m_srb[slot])))
+      {
+        eventWheel.schedule(target, srb::actionTime(m_srb[slot]));
+      }
+    }
+
+    int64_t emitted{0};
+    int64_t enqueued{0};
+    bool balanced{true};
+    bool unique{true};
+    std::vector<int32_t> slotTick(signalBufferCapacity, -1);
+    for (int32_t t = 0; t < rounds && neurons.advanceMasterClock() != INT32_MAX; ++t)
+    {
+      neurons.scanNeuronsForSignals();
+      int64_t tickEmitted{0};
+      int64_t tickEnqueued{0};
+      for (int32_t p = 0; p < tickPartitions.count(); ++p)
+      {
+        tickEmitted += static_cast<int64_t>(tickPartitions[p].outbox.size());
+        tickEnqueued += static_cast<int64_t>(tickPartitions[p].inbox.size());
+        for (const tick::Arrival& arrival : tickPartitions[p].inbox)
+        {
+          int32_t& stamp = slotTick[srb::handleSlot(arrival.handle)];
+          unique = unique && stamp != t;
+          stamp = t;
+        }
+      }
+      balanced = balanced && tickEmitted == tickEnqueued;
+      emitted += tickEmitted;
+      enqueued += tickEnqueued;
+    }
+    std::cout << emitted << " signals emitted, " << enqueued << " enqueued on " << tickWorkers.size()
+              << " threads, " << tickPartitions.count() << " partitions\n";
+    check(emitted > 0 && balanced, "every tick enqueues exactly the signals it emits");
+    check(unique, "no srb slot is enqueued twice in a tick");
+    neurons.setTickThreads(1);
+  }
+
+  std::cout << "\nsignalinboxstress failures:= " << failures << std::endl;
+  return failures;
+}
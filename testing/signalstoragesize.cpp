@@ -1,48 +1,74 @@
 #include <iostream>
 #include <vector>
+#include <climits>
 #include <cstdint>
-#include <typeinfo>
-#include <array>
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "TestCheck.h"
 
-struct Signal {
-    int32_t actionTime{};     // time when neuron needs to process this signal
-    int16_t amplitude{};      // signal size modified by connection weight at origination.
-    int16_t unused{};         // available for future use; pads signal to 8 bytes/2 words
-  };
+/**
+ * @brief Signal storage footprint, and the epoch relative signal times that make it 8 bytes.
+ *
+ * @details Oct 2026: this used to reserve a billion local 8 byte Signals and wait on a key. It now
+ * measures the real ring: a 10 million slot srb::SignalRingBuffer must take 8 bytes a slot, against
+ * the 16 a Signal with actionTime, owner and testId took, with the test id side table empty unless
+ * built with TCN_SIGNAL_TEST_IDS. Signal times must come back exactly across clock moves that
+ * rebase the epoch, and a signal older than the epoch can hold must read as INT32_MIN.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+int32_t masterClock{0};
+
+namespace
+{
+  constexpr int32_t ringSize{10000000};
+  constexpr std::size_t oldSignalBytes{16};
+}
 
 int main ()
+{
+  check(sizeof(signal::Signal) == 8, "a Signal is 8 bytes");
+
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+  std::size_t signalBytes = m_srb.capacity() * sizeof(signal::Signal);
+  std::size_t testIdBytes = m_srbTestIds.capacity() * sizeof(std::int32_t);
+  check(signalBufferCapacity == ringSize && signalBytes == static_cast<std::size_t>(ringSize) * 8,
+        "the ring takes 8 bytes a slot");
+  check(srb::signalTestIds ? m_srbTestIds.size() == m_srb.size() : testIdBytes == 0,
+        srb::signalTestIds ? "test ids kept alongside the ring" : "no test id storage without TCN_SIGNAL_TEST_IDS");
+  check(!srb::signalTestIds || srb::testId(ringSize - 1) == ringSize - 1, "test ids past INT16_MAX keep their slot number");
+  check(srb::actionTime(m_srb.back()) == INT32_MIN, "blank slots read as long past");
+
+  std::cout << ringSize << " signals: " << signalBytes / (1024 * 1024) << " MB, test ids "
+            << testIdBytes / (1024 * 1024) << " MB; " << oldSignalBytes * ringSize / (1024 * 1024)
+            << " MB at " << oldSignalBytes << " bytes a signal\n";
+
+  // times survive the epoch following the clock
+  masterClock = 1000;
+  int32_t recent = ring.allocateSignalSlot();
+  m_srb[recent] = srb::makeSignal(masterClock + srb::maxSignalDistance, 7, 1234);
+  int32_t old = ring.allocateSignalSlot();
+  m_srb[old] = srb::makeSignal(masterClock - 5, 8, -1234);
+  bool exact{true};
+  for (int32_t step = 0; step < 3; ++step)
   {
-    std::vector<Signal> signalVector; 
-    signalVector.reserve(1000000000);   // capacity for 1,000,000,000 signals
-    // test allocation of Signal vector
-    auto begin{signalVector.begin()};
-    auto end{signalVector.end()};
-
-    // fill the vector elements
-    Signal aSignal = {1, 1000};
-
-    for (int i=1; i < signalVector.capacity(); ++i) {
-      signalVector.push_back(aSignal);
-    }
-
-    // for (auto& s: signalVector) {
-    //   s.actionTime = 1;
-    //   s.amplitude = 1000;
-    // }
-    // print signal element
-     std::cout << "Signal 1. actionTime: " << aSignal.actionTime << " aSignal.amplitude: " << aSignal.amplitude << std::endl;
-     std::cout << "Vector [0]: actionTime: " << signalVector[0].actionTime << " amplitude: " << signalVector[0].amplitude << std::endl;
-
-    size_t vector_object_size = sizeof(signalVector);
-    size_t element_memory = signalVector.capacity() * sizeof(Signal);
-    std::cout << "Struct size: " << sizeof(Signal) << std:: endl;
-    std::cout << "Size of vector object: " << sizeof(signalVector) << std::endl;
-    std::cout << "Element storage: " << element_memory << std::endl;
-    std::cout << "Total storage: " << element_memory + vector_object_size << std::endl;
-    std::cout << "Press any key: ";
-    int wait{};
-    std::cin >> wait;   // wait for any key
-
-    return 0;
+    masterClock += srb::epochSpan / 3;   // reaches the recent signal's time, rebasing once
+    srb::followClock(masterClock);
+    exact = exact && srb::actionTime(m_srb[recent]) == 1000 + srb::maxSignalDistance &&
+            srb::actionTime(m_srb[old]) == 995 && m_srb[recent].sourceConnId == 7 && m_srb[recent].amplitude == 1234;
   }
+  check(exact && signalEpoch > 0, "signal times are exact through a rebase, up to maxSignalDistance ahead");
+  masterClock += 2 * srb::epochSpan;
+  srb::followClock(masterClock);
+  check(masterClock - signalEpoch >= 0 && masterClock - signalEpoch < srb::epochSpan, "the epoch follows the clock");
+  check(srb::actionTime(m_srb[old]) == INT32_MIN && m_srb[old].amplitude == -1234,
+        "a signal older than the epoch can hold reads as long past");
+
+  masterClock = 0;
+  srb::followClock(masterClock);
+  check(signalEpoch == 0 && srb::actionTime(m_srb[old]) == INT32_MIN, "the epoch follows a clock set back");
 
+  std::cout << "\nsignalstoragesize failures:= " << failures << std::endl;
+  return failures;
+}
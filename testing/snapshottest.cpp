@@ -0,0 +1,279 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "TCNTopology.h"
+#include "NetworkBuilder.h"
+#include "Snapshot.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern int32_t currentSignalSlot;
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+extern std::vector<connection::HotConnection> m_connHot;
+extern bool connPoolPacked;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief A restored snapshot carries on exactly where the saved network left off.
+ *
+ * @details A random network of twelve SixPacks is seeded and run for a number of ticks, saved,
+ * and run on; the whole state is digested after every tick as in paralleltickstest. The globals
+ * are then wiped and the snapshot restored - with one thread and with four - and the run repeated.
+ * Both must give the same digest on every tick, so topology, weights, last signal times, srb
+ * contents and cursor, queues and clocks all came back. The mapped views must match the live
+ * pools, and truncated, foreign and other version files must be rejected.
+ *
+ * Save and restore time for the default topology's connection network is printed, not checked.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+constexpr int32_t sixPacks{12};
+constexpr int32_t poolSize{sixPacks * tconst::sixpack_size};
+constexpr int32_t fanOut{12};
+constexpr int32_t ringSize{20000};
+constexpr int32_t warmUp{120};
+constexpr int32_t ticks{150};
+const char* snapshotFile{"snapshottest.snap"};
+const char* brokenFile{"snapshottest.bad"};
+
+uint64_t fold(uint64_t digest, int64_t value)
+{
+  // FNV-1a over the value's bytes
+  for (int i = 0; i < 8; ++i)
+  {
+    digest ^= static_cast<uint64_t>(value >> (8 * i)) & 0xFF;
+    digest *= 1099511628211ULL;
+  }
+  return digest;
+}
+
+uint64_t stateDigest()
+{
+  uint64_t digest{14695981039346656037ULL};
+  digest = fold(digest, masterClock);
+  for (int32_t n = 0; n < m_neuronPool.size(); ++n)
+  {
+    digest = fold(digest, m_neuronPool.nextEvent[n]);
+    digest = fold(digest, m_neuronPool.refractoryEnd[n]);
+    digest = fold(digest, static_cast<int64_t>(m_neuronPool.incomingSignals[n].size()));
+    for (srb::SignalHandle handle : m_neuronPool.incomingSignals[n])
+    {
+      digest = fold(digest, handle);
+    }
+  }
+  digest = fold(digest, currentSignalSlot);
+  digest = fold(digest, srbStats.wraps);
+  for (const signal::Signal& s : m_srb)
+  {
+    digest = fold(digest, srb::actionTime(s));
+    digest = fold(digest, s.sourceConnId);
+    digest = fold(digest, s.amplitude);
+  }
+  const std::size_t connectionCount = connPoolPacked ? m_connHot.size() : m_connPool.size();
+  for (std::size_t cidx = 0; cidx < connectionCount; ++cidx)
+  {
+    const connection::Connection c = conns::Connections::connectionAt(static_cast<int32_t>(cidx));
+    digest = fold(digest, c.targetNeuronSlot);
+    digest = fold(digest, c.lastSignalOriginTime);
+    digest = fold(digest, c.stpWeight);
+  }
+  return digest;
+}
+
+std::vector<uint64_t> run(neurons::Neurons& neurons, int32_t count)
+{
+  std::vector<uint64_t> digests;
+  for (int32_t t = 0; t < count && neurons.advanceMasterClock() != INT32_MAX; ++t)
+  {
+    neurons.scanNeuronsForSignals();
+    digests.push_back(stateDigest());
+  }
+  return digests;
+}
+
+void buildNetwork(neurons::Neurons& neurons, conns::Connections& connections)
+{
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+  m_neuronPool.resize(poolSize, INT32_MAX, -tconst::refractoryWidth - 1);
+  neurons.setTickThreads(1);
+  masterClock = 0;
+  eventWheel.reset(masterClock);
+
+  std::mt19937 rng(20261017);
+  int32_t conn{1};
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    for (int32_t f = 0; f < fanOut; ++f, ++conn)
+    {
+      int32_t target = static_cast<int32_t>(rng() % poolSize);
+      int32_t distance = 1 + static_cast<int32_t>(rng() % 12);
+      int16_t weight = static_cast<int16_t>(4000 + rng() % 9000);
+      m_connPool[conn] = connection::Connection{target, 0, distance, weight, 0};
+      m_neuronPool.addOutgoing(n, conn);
+    }
+  }
+  m_neuronPool.buildOutgoingIndex();
+
+  for (int32_t i = 0; i < poolSize / 8; ++i)
+  {
+    int32_t target = static_cast<int32_t>(rng() % poolSize);
+    int32_t slot = ring.allocateSignalSlot();
+    m_srb[slot] = srb::makeSignal(1 + static_cast<int32_t>(rng() % 20), 0, tconst::cascadeThreshold);
+    if (connections.enqueueSignal(target, srb::makeHandle(slot), srb::actionTime(m_srb[slot])))
+    {
+      eventWheel.schedule(target, srb::actionTime(m_srb[slot]));
+    }
+  }
+}
+
+void wipeNetwork()
+{
+  // nothing of the saved network may survive into the restore
+  m_neuronPool.resize(7, 0, 0);
+  m_connPool.assign(3, connection::Connection{9, 9, 9, 9, 9});
+  srb::SignalRingBuffer(11);
+  srbStats.wraps = 99;
+  masterClock = 12345;
+  eventWheel.reset(masterClock);
+  eventWheel.schedule(0, masterClock);
+}
+
+bool rejected(const std::string& path)
+{
+  try
+  {
+    snapshot::MappedSnapshot image(path);
+  }
+  catch (const std::invalid_argument&)
+  {
+    return true;
+  }
+  return false;
+}
+
+void writeBroken(const std::vector<char>& bytes)
+{
+  std::ofstream out(brokenFile, std::ios::binary | std::ios::trunc);
+  out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+int main ()
+{
+  conns::Connections connections = conns::Connections(poolSize * fanOut + 1);
+  neurons::Neurons neurons = neurons::Neurons(poolSize);
+
+  buildNetwork(neurons, connections);
+  run(neurons, warmUp);
+  int64_t written = snapshot::save(snapshotFile);
+  const uint64_t saved = stateDigest();
+  std::cout << "saved " << written << " bytes at masterClock " << masterClock << '\n';
+  std::vector<uint64_t> reference = run(neurons, ticks);
+
+  {
+    snapshot::MappedSnapshot image(snapshotFile);
+    wipeNetwork();
+    snapshot::restore(image);
+    check(stateDigest() == saved, "restore brings back the saved state");
+    check(image.connections().size == m_connPool.size() && image.connections()[5].targetNeuronSlot == m_connPool[5].targetNeuronSlot &&
+          image.nextEvent().size == static_cast<std::size_t>(poolSize) && image.header().masterClock == masterClock,
+          "mapped sections are the pools in place");
+  }
+  check(run(neurons, ticks) == reference, "restored network ticks exactly as the original");
+
+  wipeNetwork();
+  neurons.setTickThreads(4);
+  snapshot::restore(snapshotFile);
+  check(tickPartitions.count() == 4 && run(neurons, ticks) == reference, "restored with four threads ticks the same");
+  neurons.setTickThreads(1);
+
+  // the packed connection pool saves its hot and cold sections instead
+  wipeNetwork();
+  snapshot::restore(snapshotFile);
+  connections.packPool();
+  snapshot::save(snapshotFile);
+  wipeNetwork();
+  {
+    snapshot::MappedSnapshot image(snapshotFile);
+    snapshot::restore(image);
+    check(connPoolPacked && m_connPool.empty() && image.connections().size == 0 &&
+          image.hotConnections().size == m_connHot.size() && stateDigest() == saved, "packed pool restored packed");
+  }
+  check(run(neurons, ticks) == reference, "restored packed network ticks the same");
+  connections.unpackPool();
+
+  // files the snapshot must refuse
+  std::vector<char> bytes;
+  {
+    std::ifstream in(snapshotFile, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  std::vector<char> broken(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(bytes.size() / 2));
+  writeBroken(broken);
+  check(rejected(brokenFile), "truncated file rejected");
+  broken = bytes;
+  broken[0] = 'X';
+  writeBroken(broken);
+  check(rejected(brokenFile), "wrong magic rejected");
+  broken = bytes;
+  ++reinterpret_cast<snapshot::Header*>(broken.data())->version;
+  writeBroken(broken);
+  check(rejected(brokenFile), "other format version rejected");
+  broken = bytes;
+  reinterpret_cast<snapshot::Header*>(broken.data())->signalSize += 4;
+  writeBroken(broken);
+  check(rejected(brokenFile), "other struct layout rejected");
+  bool missing{false};
+  try
+  {
+    snapshot::MappedSnapshot image("snapshottest.missing");
+  }
+  catch (const std::runtime_error&)
+  {
+    missing = true;
+  }
+  check(missing, "missing file reported");
+
+  // the tcnconstants network, for scale
+  const topology::DefaultTopology defaultTopology{};
+  neurons::Neurons full = neurons::Neurons(defaultTopology);
+  m_connPool.assign(1, connection::Connection{-1, -1, -1, -1, -1});
+  currentConnectionSlot = 0;
+  tickWorkers.resize(0);
+  auto start = std::chrono::steady_clock::now();
+  netbuild::buildConnectionNetwork(defaultTopology);
+  std::chrono::duration<double, std::milli> built = std::chrono::steady_clock::now() - start;
+  start = std::chrono::steady_clock::now();
+  written = snapshot::save(snapshotFile);
+  std::chrono::duration<double, std::milli> save = std::chrono::steady_clock::now() - start;
+  const uint64_t fullDigest = stateDigest();
+  wipeNetwork();
+  start = std::chrono::steady_clock::now();
+  snapshot::restore(snapshotFile);
+  std::chrono::duration<double, std::milli> restore = std::chrono::steady_clock::now() - start;
+  check(stateDigest() == fullDigest, "default topology network restored");
+  std::cout << "default topology: " << m_connPool.size() << " connections, " << written / (1024 * 1024)
+            << " MB: built in " << built.count() << " msecs, saved in " << save.count()
+            << " msecs, restored in " << restore.count() << " msecs\n";
+  tickWorkers.resize(1);
+
+  std::remove(snapshotFile);
+  std::remove(brokenFile);
+  std::cout << "\nsnapshottest failures:= " << failures << std::endl;
+  return failures;
+}
@@ -0,0 +1,110 @@
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <climits>
+#include <stdexcept>
+
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "TestCheck.h"
+
+extern std::int32_t currentSignalSlot;
+extern std::int32_t signalBufferCapacity;
+extern std::vector<signal::Signal> m_srb;
+
+std::int32_t masterClock{0};            // normally comes with the neuron pool
+
+/**
+ * @brief Wrap detection, live overwrite counting and the three wrap policies of the srb.
+ *
+ * @details A 100 slot ring is filled with signals due in the future so every slot is live,
+ * then allocation carries on past the end:
+ *    Overwrite   wraps, counts one live overwrite per reused slot
+ *    FailFast    throws on the first live slot
+ *    Grow        appends capacity at the end of the ring instead of wrapping
+ * Finally the clock moves past every signal so nothing is live and the ring wraps cleanly.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+std::int32_t putSignal(srb::SignalRingBuffer& ring, std::int32_t actionTime)
+{
+  std::int32_t slot = ring.allocateSignalSlot();
+  m_srb[slot] = srb::makeSignal(actionTime, 1, 1000);
+  return slot;
+}
+
+int main ()
+{
+  constexpr std::int32_t ringSize{100};
+
+  // Overwrite - the default
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+  masterClock = 1000;
+  std::int32_t maxSlot{0};
+  for (std::int32_t i = 0; i < ringSize - 1; ++i)
+  {
+    std::int32_t slot = putSignal(ring, masterClock + 50);
+    maxSlot = (slot > maxSlot) ? slot : maxSlot;
+  }
+  check(maxSlot == ringSize - 1 && srbStats.wraps == 0, "first lap uses slots 1..capacity-1 without wrapping");
+  check(srbStats.liveWindowHighWater == ringSize - 1, "live window covers every allocated slot");
+
+  check(putSignal(ring, masterClock + 50) == 0, "ring wraps to slot 0");
+  check(srbStats.wraps == 1 && srbStats.liveOverwrites == 0, "never used slot 0 is not a live overwrite");
+  for (std::int32_t i = 0; i < 10; ++i)
+  {
+    putSignal(ring, masterClock + 50);
+  }
+  check(srbStats.liveOverwrites == 10, "reusing live slots is counted");
+  check(ring.suggestedCapacity() > ringSize, "suggested capacity is above the overrun ring");
+
+  // nothing live once the clock has passed every signal and its aggregation window
+  masterClock += 50 + tcnconstants::aggregation_window_ticks;
+  std::int64_t overwritesBefore = srbStats.liveOverwrites;
+  for (std::int32_t i = 0; i < 2 * ringSize; ++i)
+  {
+    putSignal(ring, masterClock + 1);
+  }
+  check(srbStats.liveOverwrites - overwritesBefore == ringSize, "only signals made in this pass were live on the second lap");
+
+  // FailFast
+  ring = srb::SignalRingBuffer(ringSize);
+  srbWrapPolicy = srb::WrapPolicy::FailFast;
+  masterClock = 1000;
+  bool threw{false};
+  try
+  {
+    for (std::int32_t i = 0; i < 2 * ringSize; ++i)
+    {
+      putSignal(ring, masterClock + 50);
+    }
+  }
+  catch (const std::length_error& e)
+  {
+    threw = true;
+    std::cout << "caught: " << e.what() << '\n';
+  }
+  check(threw && srbStats.liveOverwrites == 0, "FailFast throws before overwriting a live slot");
+
+  // Grow
+  ring = srb::SignalRingBuffer(ringSize);
+  srbWrapPolicy = srb::WrapPolicy::Grow;
+  masterClock = 1000;
+  std::vector<std::int32_t> slots;
+  for (std::int32_t i = 0; i < 3 * ringSize; ++i)
+  {
+    slots.push_back(putSignal(ring, masterClock + 50 + i));
+  }
+  bool intact{true};
+  for (std::int32_t i = 0; i < 3 * ringSize; ++i)
+  {
+    intact = intact && srb::actionTime(m_srb[slots[i]]) == masterClock + 50 + i;
+  }
+  check(srbStats.grows == 2 && signalBufferCapacity == 4 * ringSize, "Grow doubled the ring twice");
+  check(srbStats.wraps == 0 && srbStats.liveOverwrites == 0 && intact, "Grow kept every live signal");
+
+  ring.printStats();
+  std::cout << "\nsrbstatstest failures:= " << failures << std::endl;
+  return failures;
+}
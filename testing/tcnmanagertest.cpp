@@ -0,0 +1,297 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+#include "TCNState.h"
+#include "aTCNManager.h"
+#include "TCNTopology.h"
+#include "NetworkBuilder.h"
+#include "TestCheck.h"
+
+extern int32_t masterClock;
+extern int32_t currentSignalSlot;
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief The aTCNManager runs several TCNs in one process exactly as each would run alone.
+ *
+ * @details Six small random networks of different sizes, seeds and start clocks - one with no
+ * signals at all - are built into one manager. Each TCN's state is digested after every tick it
+ * processes: masterClock, every neuron's nextEvent, refractoryEnd and queue of handles, the srb
+ * cursor and contents and every connection's last signal time.
+ *
+ * The reference is each network alone in its own manager, one thread. Together, with a slice
+ * of 1, the master_clock must rise slice by slice, every TCN must tick exactly when it would
+ * alone, and the idle TCN must never be swapped in. With a wide slice and four tick threads - the
+ * TCNs still run one at a time, the threads split their ticks - the state at the end of every
+ * slice must match the state alone after the same number of ticks.
+ *
+ * Oct 2026: two TCNs built with netbuild must each hand out connection ids from 1, just after
+ * the blank connection 0, into a pool of exactly their own size - netbuild's cursor,
+ * currentConnectionSlot, is part of each TCN's state.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+struct Network {
+  int32_t sixPacks;
+  uint32_t seed;
+  int32_t start;          // masterClock of the first seed signal
+  int32_t seedSignals;    // 0 leaves the network idle
+};
+
+const Network networks[] = { {2, 11, 0, 40}, {1, 23, 7, 20}, {3, 37, 0, 60}, {1, 41, 0, 0},
+                             {2, 53, 300, 30}, {1, 67, 3, 25} };
+constexpr int32_t networkCount{6};
+constexpr int32_t fanOut{10};
+constexpr int32_t until{700};
+
+uint64_t fold(uint64_t digest, int64_t value)
+{
+  // FNV-1a over the value's bytes
+  for (int i = 0; i < 8; ++i)
+  {
+    digest ^= static_cast<uint64_t>(value >> (8 * i)) & 0xFF;
+    digest *= 1099511628211ULL;
+  }
+  return digest;
+}
+
+uint64_t stateDigest()
+{
+  // the live TCN
+  uint64_t digest{14695981039346656037ULL};
+  digest = fold(digest, masterClock);
+  for (int32_t n = 0; n < m_neuronPool.size(); ++n)
+  {
+    digest = fold(digest, m_neuronPool.nextEvent[n]);
+    digest = fold(digest, m_neuronPool.refractoryEnd[n]);
+    digest = fold(digest, static_cast<int64_t>(m_neuronPool.incomingSignals[n].size()));
+    for (srb::SignalHandle handle : m_neuronPool.incomingSignals[n])
+    {
+      digest = fold(digest, handle);
+    }
+  }
+  digest = fold(digest, currentSignalSlot);
+  for (const signal::Signal& s : m_srb)
+  {
+    digest = fold(digest, srb::actionTime(s));
+    digest = fold(digest, s.sourceConnId);
+    digest = fold(digest, s.amplitude);
+  }
+  for (const connection::Connection& c : m_connPool)
+  {
+    digest = fold(digest, c.lastSignalOriginTime);
+  }
+  return digest;
+}
+
+void build(const Network& network)
+{
+  // into the live TCN
+  const int32_t poolSize = network.sixPacks * tconst::sixpack_size;
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(poolSize * 8);
+  conns::Connections connections = conns::Connections(poolSize * fanOut + 1);
+  neurons::Neurons neurons = neurons::Neurons(poolSize);
+  m_neuronPool.resize(poolSize, INT32_MAX, -tconst::refractoryWidth - 1);   // every neuron ready to cascade
+  neurons.setTickThreads(tickWorkers.size());
+  masterClock = network.start;
+  eventWheel.reset(masterClock);
+
+  std::mt19937 rng(network.seed);
+  int32_t conn{1};
+  for (int32_t n = 0; n < poolSize; ++n)
+  {
+    for (int32_t f = 0; f < fanOut; ++f, ++conn)
+    {
+      int32_t target = static_cast<int32_t>(rng() % poolSize);
+      int32_t distance = 1 + static_cast<int32_t>(rng() % 12);
+      int16_t weight = static_cast<int16_t>(4000 + rng() % 9000);
+      m_connPool[conn] = connection::Connection{target, 0, distance, weight, 0};
+      m_neuronPool.addOutgoing(n, conn);
+    }
+  }
+  m_neuronPool.buildOutgoingIndex();
+
+  for (int32_t i = 0; i < network.seedSignals; ++i)
+  {
+    int32_t target = static_cast<int32_t>(rng() % poolSize);
+    int32_t slot = ring.allocateSignalSlot();
+    m_srb[slot] = srb::makeSignal(network.start + 1 + static_cast<int32_t>(rng() % 20), 0, tconst::cascadeThreshold);
+    if (connections.enqueueSignal(target, srb::makeHandle(slot), srb::actionTime(m_srb[slot])))
+    {
+      eventWheel.schedule(target, srb::actionTime(m_srb[slot]));
+    }
+  }
+}
+
+struct Trace {
+  std::vector<int32_t> clocks;      // masterClock of every tick
+  std::vector<uint64_t> digests;    // state after it
+};
+
+void record(tcnmanager::aTCNManager& manager, std::vector<Trace>& traces, std::vector<int64_t>& seen)
+{
+  // digest every TCN that ticked in the last slice
+  for (int32_t t = 0; t < manager.count(); ++t)
+  {
+    if (manager.state(t).ticks != seen[t])
+    {
+      seen[t] = manager.state(t).ticks;
+      manager.select(t);
+      traces[t].clocks.push_back(masterClock);
+      traces[t].digests.push_back(stateDigest());
+    }
+  }
+}
+
+int main ()
+{
+  // alone
+  std::vector<Trace> alone(networkCount);
+  std::vector<int64_t> aloneTicks(networkCount);
+  for (int32_t t = 0; t < networkCount; ++t)
+  {
+    tcnmanager::aTCNManager manager(1);
+    manager.addTCN([t] { build(networks[t]); });
+    std::vector<Trace> traces(1);
+    std::vector<int64_t> seen(1, 0);
+    while (tcnmanager::l_f_c < until && manager.advance(1) != INT32_MAX)
+    {
+      record(manager, traces, seen);
+    }
+    alone[t] = traces[0];
+    aloneTicks[t] = manager.state(0).ticks;
+    std::cout << "TCN " << t << " alone: " << aloneTicks[t] << " ticks\n";
+  }
+
+  // together, slice of 1
+  {
+    tcnmanager::aTCNManager manager(1);
+    bool numbered{true};
+    for (int32_t t = 0; t < networkCount; ++t)
+    {
+      numbered = numbered && manager.addTCN([t] { build(networks[t]); }) == t;
+    }
+    check(numbered && manager.active() == -1, "tcn numbers are handed out in order and built TCNs are parked");
+    std::vector<Trace> traces(networkCount);
+    std::vector<int64_t> seen(networkCount, 0);
+    bool rising{true};
+    bool inSlice{true};
+    int32_t previous{INT32_MIN};
+    int64_t slices{0};
+    while (tcnmanager::l_f_c < until && manager.advance(1) != INT32_MAX)
+    {
+      rising = rising && tcnmanager::master_clock > previous;
+      previous = tcnmanager::master_clock;
+      ++slices;
+      std::vector<int64_t> before = seen;
+      record(manager, traces, seen);
+      for (int32_t t = 0; t < networkCount; ++t)
+      {
+        // a slice of 1 is one tick, at the master_clock, for every TCN that ran in it
+        if (seen[t] != before[t])
+        {
+          inSlice = inSlice && seen[t] == before[t] + 1 && traces[t].clocks.back() == tcnmanager::master_clock;
+        }
+      }
+    }
+    bool same{true};
+    for (int32_t t = 0; t < networkCount; ++t)
+    {
+      same = same && traces[t].clocks == alone[t].clocks && traces[t].digests == alone[t].digests;
+    }
+    std::cout << slices << " slices\n";
+    check(rising, "master_clock rises slice by slice");
+    check(inSlice, "every TCN that runs in a slice ticks once, at the master_clock");
+    check(same, "every TCN ticks at the same clocks with the same state as it does alone");
+    check(manager.state(3).activations == 0 && manager.state(3).ticks == 0, "the idle TCN is never swapped in");
+    check(tcnmanager::l_f_c >= until, "stopped at the first slice past until");
+  }
+
+  // together, wide slice, parallel ticks
+  {
+    tcnmanager::aTCNManager manager(4);
+    for (int32_t t = 0; t < networkCount; ++t)
+    {
+      manager.addTCN([t] { build(networks[t]); });
+    }
+    std::vector<int64_t> seen(networkCount, 0);
+    bool same{true};
+    int64_t slices{0};
+    int64_t compared{0};
+    while (tcnmanager::l_f_c < until && manager.advance(16) != INT32_MAX)
+    {
+      ++slices;
+      for (int32_t t = 0; t < networkCount; ++t)
+      {
+        // only the state at the end of each slice can be seen - compare it with the same tick alone
+        int64_t ticks = manager.state(t).ticks;
+        if (ticks != seen[t] && ticks <= static_cast<int64_t>(alone[t].digests.size()))
+        {
+          manager.select(t);
+          same = same && masterClock == alone[t].clocks[ticks - 1] && stateDigest() == alone[t].digests[ticks - 1];
+          ++compared;
+        }
+        seen[t] = ticks;
+      }
+    }
+    int64_t activations{0};
+    for (int32_t t = 0; t < networkCount; ++t)
+    {
+      // a slice can end up to 15 ticks past until, so a TCN may have run further than alone
+      same = same && manager.state(t).ticks >= aloneTicks[t];
+      activations += manager.state(t).activations;
+    }
+    std::cout << slices << " slices, " << activations << " activations on " << tickWorkers.size()
+              << " threads, " << compared << " states compared\n";
+    check(same && compared > 0, "a wide slice and four tick threads give the same states as alone");
+  }
+
+  // netbuild networks: each TCN's connection ids start over
+  {
+    tcnmanager::aTCNManager manager(1);
+    const topology::DynamicTopology small(3, {5, 2, 5, 2});
+    const topology::DynamicTopology larger(3, {6, 2, 6, 2});
+    std::vector<int32_t> firstSlot;
+    std::vector<int64_t> built;
+    for (const topology::DynamicTopology* topology : {&small, &larger})
+    {
+      manager.addTCN([&, topology] {
+        conns::Connections connections = conns::Connections(1);
+        neurons::Neurons neurons = neurons::Neurons(*topology);
+        firstSlot.push_back(currentConnectionSlot);
+        built.push_back(netbuild::buildConnectionNetwork(*topology));
+      });
+    }
+    bool fresh{true};
+    for (int32_t t = 0; t < manager.count(); ++t)
+    {
+      manager.select(t);
+      int32_t lowest{INT32_MAX};
+      for (int32_t connIdx : m_neuronPool.outgoingSignals)
+      {
+        lowest = (connIdx < lowest) ? connIdx : lowest;
+      }
+      fresh = fresh && firstSlot[t] == 0 && lowest == 1 && currentConnectionSlot == built[t] &&
+              static_cast<int64_t>(m_connPool.size()) == built[t] + 1;
+    }
+    manager.park();
+    check(fresh && built[0] != built[1], "netbuild TCNs each start at connection id 0 with a pool of their own size");
+  }
+
+  tickWorkers.resize(1);
+  std::cout << "\ntcnmanagertest failures:= " << failures << std::endl;
+  return failures;
+}
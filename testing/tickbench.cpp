@@ -0,0 +1,258 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <random>
+#include <string>
+#include <algorithm>
+#include "Connections.h"
+#include "Connection.h"
+#include "Signal.h"
+#include "SignalRingBuffer.h"
+#include "Neurons.h"
+#include "Neuron.h"
+
+extern int32_t masterClock;
+extern std::vector<signal::Signal> m_srb;
+extern std::vector<connection::Connection> m_connPool;
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Microbenchmarks for the tick loop, the fan-out, srb allocation, the purge and pool
+ * construction, written out as JSON.
+ *
+ * @details Oct 2026: one run per combination of network size, fan-out and firing rate. Each run
+ * times, on a random network of that shape:
+ *   construct/...          Connections, SignalRingBuffer and Neurons construction, per element
+ *   srb/allocateSignalSlot one slot at a time over a blank ring, twice round it
+ *   fanout/generateOutGoingSignals   the immediate fan-out of up to 10000 neurons, per signal
+ *   purge/purgeOldSignals  every queue filled by the fan-out purged once it is stale, per entry
+ *   tick/scanNeuronsForSignals       whole ticks, sweep included, per tick
+ * The firing rate is the fraction of the neurons driven to cascadeThreshold by an outside signal
+ * every tick; the network's own signals come on top, so the tick entry also reports the rate
+ * that was observed. Weights are kept low enough that the drive, not the network, sets the pace.
+ *
+ * stdout is a single JSON document - {"context": {...}, "benchmarks": [...]} - meant to be kept
+ * per release and compared; anything that goes wrong is reported on stderr.
+ *
+ * usage: tickbench [neurons] [fan-outs] [firing rates] [ticks] [tick threads]
+ *        each of the first three a comma separated list, e.g. tickbench 10000,100000 8,32 0.01,0.05
+ * Neuron counts are rounded up to whole SixPacks. Build with -DNDEBUG so tracing does not swamp
+ * the timings; add -mavx2 or -DTCN_HUGE_PAGES=1 to compare kernels and pool backing.
+ *
+ * @return  0 if ok; else the number of runs whose sanity checks failed
+ */
+
+using benchClock = std::chrono::steady_clock;
+
+constexpr int32_t maxRingSize{1 << 24};         // 128 MB of signals
+constexpr int32_t fanOutSample{10000};
+constexpr int32_t maxDistance{12};
+
+double msecsSince(benchClock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+}
+
+std::vector<double> parseList(const char* arg)
+{
+  std::vector<double> values;
+  for (const char* p = arg; *p != '\0'; )
+  {
+    values.push_back(std::atof(p));
+    const char* comma = std::strchr(p, ',');
+    p = (comma != nullptr) ? comma + 1 : p + std::strlen(p);
+  }
+  return values;
+}
+
+struct Params {
+  int32_t neurons;
+  int32_t fanOut;
+  double firingRate;
+};
+
+bool firstResult{true};
+
+void result(const char* name, const Params& params, int64_t ops, double msecs,
+            const std::vector<std::pair<const char*, double>>& counters = {})
+{
+  // one Google Benchmark style entry; ns_per_op is per element, slot, signal, entry or tick
+  std::cout << (firstResult ? "\n" : ",\n") << "    {\"name\": \"" << name << "/neurons:" << params.neurons
+            << "/fanout:" << params.fanOut << "/rate:" << params.firingRate << "\", \"neurons\": " << params.neurons
+            << ", \"fanout\": " << params.fanOut << ", \"firing_rate\": " << params.firingRate
+            << ", \"ops\": " << ops << ", \"real_time_ms\": " << msecs
+            << ", \"ns_per_op\": " << ((ops > 0) ? msecs * 1e6 / static_cast<double>(ops) : 0.0);
+  for (const std::pair<const char*, double>& counter : counters)
+  {
+    std::cout << ", \"" << counter.first << "\": " << counter.second;
+  }
+  std::cout << '}';
+  firstResult = false;
+}
+
+void buildNetwork(const Params& params, std::mt19937& rng)
+{
+  // fanOut random connections per neuron, weights well under the threshold
+  m_neuronPool.resize(params.neurons, INT32_MAX, -tconst::refractoryWidth - 1);
+  int32_t conn{1};
+  for (int32_t n = 0; n < params.neurons; ++n)
+  {
+    for (int32_t f = 0; f < params.fanOut; ++f, ++conn)
+    {
+      int32_t target = static_cast<int32_t>(rng() % params.neurons);
+      int16_t weight = static_cast<int16_t>(tconst::base_signal_size * (1 + rng() % 3));
+      m_connPool[conn] = connection::Connection{target, 0, 1 + static_cast<int32_t>(rng() % maxDistance), weight, 0};
+      m_neuronPool.addOutgoing(n, conn);
+    }
+  }
+  m_neuronPool.buildOutgoingIndex();
+}
+
+int32_t run(const Params& params, int32_t ticks, int32_t threads)
+{
+  int32_t failures{0};
+  std::mt19937 rng(20261017);
+  int32_t ringSize = static_cast<int32_t>(std::min<int64_t>(int64_t{params.neurons} * params.fanOut, maxRingSize)) + 1;
+
+  // construction
+  auto start = benchClock::now();
+  conns::Connections connections = conns::Connections(params.neurons * params.fanOut + 1);
+  result("construct/Connections", params, params.neurons * int64_t{params.fanOut} + 1, msecsSince(start));
+  start = benchClock::now();
+  srb::SignalRingBuffer ring = srb::SignalRingBuffer(ringSize);
+  result("construct/SignalRingBuffer", params, ringSize, msecsSince(start));
+  start = benchClock::now();
+  neurons::Neurons neurons = neurons::Neurons(params.neurons);
+  result("construct/Neurons", params, params.neurons, msecsSince(start));
+  failures += (m_neuronPool.size() == params.neurons &&
+               m_srb.size() == static_cast<std::size_t>(ringSize)) ? 0 : 1;
+  neurons.setTickThreads(threads);
+
+  // srb allocation over a blank ring
+  masterClock = 1000;
+  eventWheel.reset(masterClock);
+  int64_t slotSum{0};
+  start = benchClock::now();
+  for (int32_t i = 0; i < 2 * ringSize; ++i)
+  {
+    slotSum += ring.allocateSignalSlot();
+  }
+  result("srb/allocateSignalSlot", params, 2 * int64_t{ringSize}, msecsSince(start));
+  failures += (slotSum > 0) ? 0 : 1;
+
+  // immediate fan-out, then purge everything it queued once it is stale
+  buildNetwork(params, rng);
+  ring = srb::SignalRingBuffer(ringSize);
+  int32_t sample = std::min(params.neurons, fanOutSample);
+  start = benchClock::now();
+  for (int32_t n = 0; n < sample; ++n)
+  {
+    connections.generateOutGoingSignals(n);
+  }
+  result("fanout/generateOutGoingSignals", params, int64_t{sample} * params.fanOut, msecsSince(start));
+
+  int64_t queued{0};
+  for (int32_t n = 0; n < params.neurons; ++n)
+  {
+    queued += static_cast<int64_t>(m_neuronPool.incomingSignals[n].size());
+  }
+  masterClock += tconst::stalePurgeThreshold + 2 * maxDistance;
+  int64_t dropped{0};
+  start = benchClock::now();
+  for (int32_t n = 0; n < params.neurons; ++n)
+  {
+    dropped += neurons.purgeOldSignals(n);
+  }
+  result("purge/purgeOldSignals", params, dropped, msecsSince(start));
+  failures += (dropped == queued && queued == int64_t{sample} * params.fanOut) ? 0 : 1;
+
+  // whole ticks, driven at the firing rate
+  buildNetwork(params, rng);
+  ring = srb::SignalRingBuffer(ringSize);
+  masterClock = 0;
+  eventWheel.reset(masterClock);
+  int32_t driven = static_cast<int32_t>(params.firingRate * params.neurons);
+  int64_t cascades{0};
+  int64_t members{0};
+  int32_t ran{0};
+  double tickMsecs{0.0};
+  for (; ran < ticks; ++ran)
+  {
+    int32_t driveTime = masterClock + 1;
+    for (int32_t i = 0; i < driven; ++i)
+    {
+      int32_t target = static_cast<int32_t>(rng() % params.neurons);
+      int32_t slot = ring.allocateSignalSlot();
+      m_srb[slot] = srb::makeSignal(driveTime, 0, tconst::cascadeThreshold);
+      if (connections.enqueueSignal(target, srb::makeHandle(slot), driveTime))
+      {
+        eventWheel.schedule(target, driveTime);
+      }
+    }
+    start = benchClock::now();
+    if (neurons.advanceMasterClock() == INT32_MAX)
+    {
+      break;
+    }
+    neurons.scanNeuronsForSignals();
+    tickMsecs += msecsSince(start);
+    cascades += neurons.activity().cascades;
+    members += neurons.activity().members;
+  }
+  double perTick = (ran > 0) ? 1.0 / ran : 0.0;
+  result("tick/scanNeuronsForSignals", params, ran, tickMsecs,
+         {{"cascades_per_tick", static_cast<double>(cascades) * perTick},
+          {"observed_rate", static_cast<double>(cascades) * perTick / params.neurons},
+          {"active_neurons", static_cast<double>(members) * perTick},
+          {"ns_per_cascade", (cascades > 0) ? tickMsecs * 1e6 / static_cast<double>(cascades) : 0.0}});
+  failures += (ran == ticks && (driven == 0 || cascades > 0)) ? 0 : 1;
+  neurons.setTickThreads(1);
+
+  if (failures > 0)
+  {
+    std::cerr << "tickbench: " << failures << " sanity checks failed at neurons " << params.neurons
+              << ", fan-out " << params.fanOut << ", rate " << params.firingRate << '\n';
+  }
+  return failures;
+}
+
+int main (int argc, char* argv[])
+{
+  std::vector<double> sizes = parseList((argc > 1) ? argv[1] : "10000,100000");
+  std::vector<double> fanOuts = parseList((argc > 2) ? argv[2] : "16");
+  std::vector<double> rates = parseList((argc > 3) ? argv[3] : "0.01,0.05");
+  int32_t ticks = (argc > 4) ? std::atoi(argv[4]) : 200;
+  int32_t threads = (argc > 5) ? std::atoi(argv[5]) : 1;
+
+  std::cout << "{\n  \"context\": {\"tick_threads\": " << threads << ", \"ticks\": " << ticks
+            << ", \"sixpack_size\": " << tconst::sixpack_size
+            << ", \"huge_pages\": " << (pools::hugePages ? "true" : "false")
+#ifdef __AVX2__
+            << ", \"avx2\": true"
+#else
+            << ", \"avx2\": false"
+#endif
+            << "},\n  \"benchmarks\": [";
+
+  int32_t failures{0};
+  for (double size : sizes)
+  {
+    for (double fanOut : fanOuts)
+    {
+      for (double rate : rates)
+      {
+        int32_t sixPacks = (static_cast<int32_t>(size) + tconst::sixpack_size - 1) / tconst::sixpack_size;
+        Params params{std::max(sixPacks, 1) * tconst::sixpack_size, std::max(static_cast<int32_t>(fanOut), 1), rate};
+        failures += run(params, ticks, threads);
+      }
+    }
+  }
+  std::cout << "\n  ]\n}" << std::endl;
+  return failures;
+}
@@ -7,6 +7,8 @@
 #include "SignalRingBuffer.h"
 #include "Logger.h"
 
+std::int32_t masterClock{0};    // the srb's clock; no neuron pool here
+
 class Timer
 {
 private:
@@ -0,0 +1,142 @@
+#include <iostream>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include "Neurons.h"
+#include "Neuron.h"
+#include "TCNTopology.h"
+#include "TestCheck.h"
+
+extern neuron::NeuronPool m_neuronPool;
+
+namespace tconst = tcnconstants;
+
+/**
+ * @brief Compile time and runtime topologies place every neuron in the same pool slot.
+ *
+ * @details The default topology is pinned with static_asserts against tcnconstants and a few
+ * origins worked out by hand, so the test does not even build if the constexpr math is off.
+ * Then, for the default and two other shapes, the compile time TCNTopology and a DynamicTopology
+ * built from the same numbers must agree on every neuronId / locate, and locate must invert
+ * neuronId for every neuron. A std::array PerNeuron pool is filled by coordinates and must cover
+ * the pool exactly once. Impossible runtime topologies must be rejected.
+ *
+ * @return  0 if ok; else the number of failed checks
+ */
+
+using topology::VLayer;
+using Default = topology::DefaultTopology;
+using Small = topology::TCNTopology<2, topology::SixPackShape<3, 1, 2, 2>>;      // 3 + 5 x 4 = 23 per SixPack
+using Wide = topology::TCNTopology<7, topology::SixPackShape<1, 1, 1, 1>>;      // 6 per SixPack
+
+// 132 per SixPack; IT 5, V4 25, V2 125, V1 625 SixPacks
+static_assert(Default::sixPackSize == 132 && Default::sixPackCount == 780 && Default::neuronCount == 102960);
+static_assert(Default::origin<VLayer::IT, 0>() == 0 && Default::origin<VLayer::V4, 0>() == 5 * 132 &&
+              Default::origin<VLayer::V2, 3>() == (30 + 3) * 132 && Default::origin<VLayer::V1, 624>() == 779 * 132);
+static_assert(Default::neuronId({VLayer::V4, 1, 0, 0}) == 6 * 132 &&
+              Default::neuronId({VLayer::V4, 1, 1, 0}) == 6 * 132 + 12 &&
+              Default::neuronId({VLayer::V4, 1, 5, 23}) == 7 * 132 - 1);
+static_assert(Small::sixPackSize == 23 && Small::sixPackCount == 2 + 4 + 8 + 16 && Small::neuronCount == 30 * 23);
+static_assert(Default::locate(7 * 132 - 1).packLayer == 5 && Default::locate(7 * 132 - 1).sixPack == 1);
+
+template <typename Fixed>
+bool agrees(const topology::DynamicTopology& dynamic)
+{
+  // every neuron, both ways, both topologies
+  if (dynamic.neuronCount != Fixed::neuronCount || dynamic.sixPackCount != Fixed::sixPackCount ||
+      dynamic.sixPackSize != Fixed::sixPackSize || dynamic.V1 != Fixed::V1)
+  {
+    return false;
+  }
+  for (int32_t n = 0; n < Fixed::neuronCount; ++n)
+  {
+    topology::NeuronCoord fixed = Fixed::locate(n);
+    topology::NeuronCoord runtime = dynamic.locate(n);
+    if (fixed.vLayer != runtime.vLayer || fixed.sixPack != runtime.sixPack || fixed.packLayer != runtime.packLayer ||
+        fixed.index != runtime.index || Fixed::neuronId(fixed) != n || dynamic.neuronId(runtime) != n ||
+        fixed.sixPack >= Fixed::sixPacksIn(fixed.vLayer) || fixed.index >= Fixed::layout.shape.layerSize(fixed.packLayer))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Fixed>
+bool coversPool()
+{
+  // walk the coordinates in layout order; every slot once, in order
+  static typename Fixed::template PerNeuron<int32_t> visits{};
+  int32_t expected{0};
+  bool inOrder{true};
+  for (int32_t v = 0; v < topology::vLayerCount; ++v)
+  {
+    for (int32_t sp = 0; sp < Fixed::sixPacksIn(static_cast<VLayer>(v)); ++sp)
+    {
+      for (int32_t layer = 0; layer < topology::packLayerCount; ++layer)
+      {
+        for (int32_t i = 0; i < Fixed::layout.shape.layerSize(layer); ++i)
+        {
+          int32_t id = Fixed::neuronId({static_cast<VLayer>(v), sp, layer, i});
+          inOrder = inOrder && id == expected++;
+          ++visits[id];
+        }
+      }
+    }
+  }
+  bool once{true};
+  for (int32_t count : visits)
+  {
+    once = once && count == 1;
+  }
+  return inOrder && once && expected == Fixed::neuronCount;
+}
+
+int main ()
+{
+  check(agrees<Default>(topology::DynamicTopology(tconst::IT, {tconst::L1_width, tconst::L1_depth, tconst::Lx_width, tconst::Lx_depth})),
+        "default: compile time and runtime topologies agree on all 102960 neurons");
+  check(agrees<Small>(topology::DynamicTopology(2, {3, 1, 2, 2})), "small: topologies agree");
+  check(agrees<Wide>(topology::DynamicTopology(7, {1, 1, 1, 1})), "wide: topologies agree");
+
+  check(coversPool<Default>() && coversPool<Small>() && coversPool<Wide>(),
+        "PerNeuron pools are covered once, in layout order");
+
+  bool rejected{true};
+  for (int32_t fanOut : {0, 300, INT32_MAX})
+  {
+    try
+    {
+      topology::DynamicTopology bad(fanOut, {6, 2, 6, 4});
+      rejected = false;
+    }
+    catch (const std::invalid_argument&)
+    {
+      ;
+    }
+  }
+  try
+  {
+    topology::DynamicTopology bad(1, {INT32_MAX, 2, 1, 1});
+    rejected = false;
+  }
+  catch (const std::invalid_argument&)
+  {
+    ;
+  }
+  check(rejected, "fan-outs of 0, fan-outs beyond the srb handle slots and oversized SixPacks are rejected");
+
+  // pool sized by the topology, tick partitions on its SixPack boundaries
+  neurons::Neurons neurons = neurons::Neurons(Small{});
+  neurons.setTickThreads(1, 4, Small::sixPackSize);
+  bool aligned = m_neuronPool.size() == Small::neuronCount && tickPartitions.count() == 4;
+  for (int32_t p = 0; p < tickPartitions.count(); ++p)
+  {
+    aligned = aligned && tickPartitions[p].first % Small::sixPackSize == 0;
+  }
+  check(aligned, "Neurons(topology) sizes the pool and aligns partitions to its SixPacks");
+
+  std::cout << "\ntopologytest failures:= " << failures << std::endl;
+  return failures;
+}